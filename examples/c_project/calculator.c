@@ -23,3 +23,28 @@ int divide(int a, int b) {
     }
     return a / b;
 }
+
+void add_n(const int* a, const int* b, int* out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = a[i] + b[i];
+    }
+}
+
+void subtract_n(const int* a, const int* b, int* out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = a[i] - b[i];
+    }
+}
+
+void multiply_n(const int* a, const int* b, int* out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = a[i] * b[i];
+    }
+}
+
+void divide_n(const int* a, const int* b, int* out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        // Per-lane zero-divisor handling, same semantics as divide()
+        out[i] = (b[i] == 0) ? 0 : a[i] / b[i];
+    }
+}
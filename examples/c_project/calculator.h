@@ -10,6 +10,8 @@
 #ifndef CALCULATOR_H
 #define CALCULATOR_H
 
+#include <stddef.h>
+
 /**
  * @brief Add two numbers
  * @param a First number
@@ -43,4 +45,57 @@ int multiply(int a, int b);
  */
 int divide(int a, int b);
 
+/**
+ * @brief Add two arrays element-wise
+ *
+ * Computes out[i] = a[i] + b[i] for every element. The simple per-element
+ * loop is free of data dependencies, so compilers can vectorize it; one
+ * call processes an entire sample buffer instead of one call per element.
+ *
+ * @param a First input array of n elements
+ * @param b Second input array of n elements
+ * @param out Output array of n elements (may alias a or b)
+ * @param n Number of elements to process
+ */
+void add_n(const int* a, const int* b, int* out, size_t n);
+
+/**
+ * @brief Subtract two arrays element-wise
+ *
+ * Computes out[i] = a[i] - b[i] for every element.
+ *
+ * @param a First input array of n elements
+ * @param b Second input array of n elements
+ * @param out Output array of n elements (may alias a or b)
+ * @param n Number of elements to process
+ */
+void subtract_n(const int* a, const int* b, int* out, size_t n);
+
+/**
+ * @brief Multiply two arrays element-wise
+ *
+ * Computes out[i] = a[i] * b[i] for every element.
+ *
+ * @param a First input array of n elements
+ * @param b Second input array of n elements
+ * @param out Output array of n elements (may alias a or b)
+ * @param n Number of elements to process
+ */
+void multiply_n(const int* a, const int* b, int* out, size_t n);
+
+/**
+ * @brief Divide two arrays element-wise
+ *
+ * Computes out[i] = a[i] / b[i] for every element. Division by zero is
+ * handled per lane: any element where b[i] is 0 yields 0 in out[i],
+ * matching the scalar divide() semantics.
+ *
+ * @param a Dividend array of n elements
+ * @param b Divisor array of n elements
+ * @param out Output array of n elements (may alias a or b)
+ * @param n Number of elements to process
+ * @note Elements with a zero divisor produce 0
+ */
+void divide_n(const int* a, const int* b, int* out, size_t n);
+
 #endif // CALCULATOR_H
@@ -0,0 +1,100 @@
+/**
+ * @file calculator_benchmark.c
+ * @brief Benchmark comparing scalar and batch calculator paths
+ *
+ * Processes a large sample buffer once per element through the scalar
+ * functions and once through the batch functions, and reports the wall
+ * time of each path. Build with optimizations so the batch loops can
+ * vectorize:
+ *
+ *     gcc -O2 -o calculator_benchmark calculator_benchmark.c calculator.c
+ *     ./calculator_benchmark
+ */
+
+/* Expose clock_gettime/CLOCK_MONOTONIC under strict C11 */
+#define _POSIX_C_SOURCE 199309L
+
+#include "calculator.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define SAMPLE_COUNT (1000000u)
+
+/**
+ * @brief Get a monotonic timestamp in seconds
+ * @return Current time in seconds
+ */
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Benchmark entry point
+ * @return 0 on success, 1 if the scalar and batch results differ
+ */
+int main(void) {
+    int* a = malloc(SAMPLE_COUNT * sizeof(int));
+    int* b = malloc(SAMPLE_COUNT * sizeof(int));
+    int* scalar_out = malloc(SAMPLE_COUNT * sizeof(int));
+    int* batch_out = malloc(SAMPLE_COUNT * sizeof(int));
+
+    if (!a || !b || !scalar_out || !batch_out) {
+        fprintf(stderr, "Allocation failed\n");
+        return 1;
+    }
+
+    // Fill inputs; make every 16th divisor zero to exercise the
+    // per-lane divide-by-zero handling
+    for (size_t i = 0; i < SAMPLE_COUNT; i++) {
+        a[i] = (int)(i % 1000) - 500;
+        b[i] = (i % 16 == 0) ? 0 : (int)(i % 97) + 1;
+    }
+
+    printf("Processing %u samples per operation\n\n", SAMPLE_COUNT);
+
+    double start = now_seconds();
+    for (size_t i = 0; i < SAMPLE_COUNT; i++) {
+        scalar_out[i] = add(a[i], b[i]);
+    }
+    for (size_t i = 0; i < SAMPLE_COUNT; i++) {
+        scalar_out[i] = subtract(scalar_out[i], b[i]);
+    }
+    for (size_t i = 0; i < SAMPLE_COUNT; i++) {
+        scalar_out[i] = multiply(scalar_out[i], b[i]);
+    }
+    for (size_t i = 0; i < SAMPLE_COUNT; i++) {
+        scalar_out[i] = divide(scalar_out[i], b[i]);
+    }
+    double scalar_time = now_seconds() - start;
+
+    start = now_seconds();
+    add_n(a, b, batch_out, SAMPLE_COUNT);
+    subtract_n(batch_out, b, batch_out, SAMPLE_COUNT);
+    multiply_n(batch_out, b, batch_out, SAMPLE_COUNT);
+    divide_n(batch_out, b, batch_out, SAMPLE_COUNT);
+    double batch_time = now_seconds() - start;
+
+    // Both paths must agree element-for-element
+    for (size_t i = 0; i < SAMPLE_COUNT; i++) {
+        if (scalar_out[i] != batch_out[i]) {
+            fprintf(stderr, "Mismatch at index %zu: %d != %d\n",
+                    i, scalar_out[i], batch_out[i]);
+            return 1;
+        }
+    }
+
+    printf("Scalar path: %.3f ms\n", scalar_time * 1000.0);
+    printf("Batch path:  %.3f ms\n", batch_time * 1000.0);
+    if (batch_time > 0.0) {
+        printf("Speedup:     %.2fx\n", scalar_time / batch_time);
+    }
+
+    free(a);
+    free(b);
+    free(scalar_out);
+    free(batch_out);
+    return 0;
+}
@@ -4,13 +4,20 @@
  */
 
 #include "Contractor.h"
+#include <algorithm>
 #include <iostream>
 
+std::vector<Contractor*> Contractor::busRegistry;
+
 Contractor::Contractor(const std::string& contractorName, int maxExt)
     : name(contractorName), maxExtension(maxExt), currentPosition(0),
-      currentState(RETRACTED), isInitialized(false), speed(5) {
+      currentState(RETRACTED), isInitialized(false), speed(5),
+      hasPendingCommand(false), pendingCommand() {
     std::cout << "[Contractor] " << name << " created with max extension "
               << maxExtension << "mm" << std::endl;
+
+    // Register on the shared actuator bus for batched flushes
+    busRegistry.push_back(this);
 }
 
 Contractor::~Contractor() {
@@ -18,6 +25,9 @@ Contractor::~Contractor() {
     if (currentState != RETRACTED) {
         retract();
     }
+
+    busRegistry.erase(std::remove(busRegistry.begin(), busRegistry.end(), this),
+                      busRegistry.end());
 }
 
 bool Contractor::initialize() {
@@ -77,10 +87,88 @@ bool Contractor::retract() {
     return true;
 }
 
+bool Contractor::queueExtend() {
+    return queueMoveTo(100);
+}
+
+bool Contractor::queueRetract() {
+    return queueMoveTo(0);
+}
+
+bool Contractor::queueMoveTo(int targetPosition) {
+    if (!isInitialized) {
+        std::cerr << "[Contractor] Error: Not initialized" << std::endl;
+        return false;
+    }
+
+    if (targetPosition < 0 || targetPosition > 100) {
+        std::cerr << "[Contractor] Error: Target must be between 0 and 100" << std::endl;
+        return false;
+    }
+
+    pendingCommand.targetPosition = targetPosition;
+    pendingCommand.speed = speed;
+    hasPendingCommand = true;
+
+    // Mirror the direction of travel immediately so getState() stays honest
+    if (targetPosition > currentPosition) {
+        currentState = EXTENDING;
+    } else if (targetPosition < currentPosition) {
+        currentState = RETRACTING;
+    }
+
+    std::cout << "[Contractor] " << name << " queued move to "
+              << targetPosition << "%" << std::endl;
+    return true;
+}
+
+bool Contractor::hasQueuedCommand() const {
+    return hasPendingCommand;
+}
+
+void Contractor::applyPendingCommand() {
+    // Update the mirrored state to match what the bus write achieved
+    currentPosition = pendingCommand.targetPosition;
+    if (currentPosition >= 100) {
+        currentState = EXTENDED;
+    } else if (currentPosition <= 0) {
+        currentState = RETRACTED;
+    }
+    hasPendingCommand = false;
+}
+
+int Contractor::flushAll() {
+    int batchSize = 0;
+    for (size_t i = 0; i < busRegistry.size(); ++i) {
+        if (busRegistry[i]->hasPendingCommand) {
+            batchSize++;
+        }
+    }
+
+    if (batchSize == 0) {
+        return 0;
+    }
+
+    // Simulate one batched bus transaction carrying every pending command
+    std::cout << "[Contractor] Flushing " << batchSize
+              << " command(s) to actuator bus" << std::endl;
+
+    for (size_t i = 0; i < busRegistry.size(); ++i) {
+        if (busRegistry[i]->hasPendingCommand) {
+            busRegistry[i]->applyPendingCommand();
+        }
+    }
+
+    return batchSize;
+}
+
 void Contractor::stop() {
     std::cout << "[Contractor] Stopping " << name << " at position "
               << currentPosition << "%" << std::endl;
 
+    // Discard any command still waiting for the next flush
+    hasPendingCommand = false;
+
     if (currentState == EXTENDING || currentState == RETRACTING) {
         // Stop at current position
         currentState = (currentPosition > 50) ? EXTENDED : RETRACTED;
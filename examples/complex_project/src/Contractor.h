@@ -10,6 +10,7 @@
 #define CONTRACTOR_H
 
 #include <string>
+#include <vector>
 
 /**
  * @brief Linear actuator controller class
@@ -31,6 +32,14 @@ public:
         ERROR         ///< Error state
     };
 
+    /**
+     * @brief A queued motion command for the actuator bus
+     */
+    struct MotionCommand {
+        int targetPosition;   ///< Target position percentage (0-100)
+        int speed;            ///< Speed for this move (1-10)
+    };
+
 private:
     State currentState;           ///< Current state of the contractor
     int currentPosition;          ///< Current position (0=retracted, 100=extended)
@@ -38,6 +47,17 @@ private:
     bool isInitialized;           ///< Initialization status
     std::string name;             ///< Name/identifier of the contractor
     int speed;                    ///< Speed of extension/retraction (1-10)
+    bool hasPendingCommand;       ///< Whether a command awaits the next bus flush
+    MotionCommand pendingCommand; ///< Command queued for the next bus flush
+
+    static std::vector<Contractor*> busRegistry;  ///< All contractors on the bus
+
+    /**
+     * @brief Apply the pending command and update the mirrored state
+     *
+     * Called by flushAll() once the batched bus write has been submitted.
+     */
+    void applyPendingCommand();
 
 public:
     /**
@@ -70,19 +90,73 @@ public:
      */
     bool retract();
 
+    /**
+     * @brief Queue a move to the fully extended position
+     *
+     * The command is not written to the actuator bus immediately; it is
+     * submitted together with commands from all other contractors by the
+     * next flushAll() call. A previously queued command is replaced.
+     *
+     * @return true if the command was queued, false if not initialized
+     */
+    bool queueExtend();
+
+    /**
+     * @brief Queue a move to the fully retracted position
+     *
+     * Like queueExtend(), the command is held until the next flushAll().
+     *
+     * @return true if the command was queued, false if not initialized
+     */
+    bool queueRetract();
+
+    /**
+     * @brief Queue a move to an arbitrary target position
+     * @param targetPosition Target position percentage (0-100)
+     * @return true if the command was queued, false if out of range
+     *         or not initialized
+     */
+    bool queueMoveTo(int targetPosition);
+
+    /**
+     * @brief Check whether a command is waiting for the next bus flush
+     * @return true if a motion command is queued, false otherwise
+     */
+    bool hasQueuedCommand() const;
+
+    /**
+     * @brief Submit all pending commands for all contractors in one batch
+     *
+     * Collects the queued command from every registered contractor and
+     * writes them to the actuator bus in a single batched transaction,
+     * then updates each contractor's mirrored state. One call per control
+     * cycle amortizes the per-write bus overhead across all doors.
+     *
+     * @return Number of commands submitted in the batch
+     */
+    static int flushAll();
+
     /**
      * @brief Stop the contractor at current position
+     *
+     * Also discards any motion command queued for the next bus flush.
      */
     void stop();
 
     /**
      * @brief Get the current state of the contractor
+     *
+     * Served from the locally mirrored state - no bus round-trip.
+     *
      * @return Current State enum value
      */
     State getState() const;
 
     /**
      * @brief Get the current position as percentage (0-100)
+     *
+     * Served from the locally mirrored state - no bus round-trip.
+     *
      * @return Current position percentage
      */
     int getPosition() const;
@@ -0,0 +1,169 @@
+/**
+ * @file DeviceRegistry.cpp
+ * @brief Implementation of DeviceRegistry class
+ */
+
+#include "DeviceRegistry.h"
+#include <iostream>
+
+size_t DeviceRegistry::internName(const std::string& id) {
+    size_t offset = nameArena.size();
+    nameArena.insert(nameArena.end(), id.begin(), id.end());
+    nameArena.push_back('\0');
+    return offset;
+}
+
+int DeviceRegistry::addServo(const std::string& servoName) {
+    servoAngles.push_back(0);
+    servoCalibrated.push_back(0);
+    servoNameOffsets.push_back(internName(servoName));
+
+    int index = static_cast<int>(servoAngles.size()) - 1;
+    std::cout << "[DeviceRegistry] Servo " << servoName
+              << " registered at index " << index << std::endl;
+    return index;
+}
+
+int DeviceRegistry::addActuator(const std::string& actuatorName, int maxExt) {
+    actuatorPositions.push_back(0);
+    actuatorStates.push_back(Contractor::RETRACTED);
+    actuatorMaxExtensions.push_back(maxExt);
+    actuatorInitialized.push_back(0);
+    actuatorNameOffsets.push_back(internName(actuatorName));
+
+    int index = static_cast<int>(actuatorPositions.size()) - 1;
+    std::cout << "[DeviceRegistry] Actuator " << actuatorName
+              << " registered at index " << index << " (max "
+              << maxExt << "mm)" << std::endl;
+    return index;
+}
+
+bool DeviceRegistry::calibrateServo(int index) {
+    std::cout << "[DeviceRegistry] Calibrating servo "
+              << getServoName(index) << "..." << std::endl;
+
+    // Simulate calibration by homing to 0 degrees
+    servoAngles[index] = 0;
+    servoCalibrated[index] = 1;
+    return true;
+}
+
+bool DeviceRegistry::setServoAngle(int index, int angle) {
+    if (angle < 0 || angle > 180) {
+        std::cerr << "[DeviceRegistry] Error: Angle must be between 0 and 180"
+                  << std::endl;
+        return false;
+    }
+
+    if (!servoCalibrated[index]) {
+        std::cerr << "[DeviceRegistry] Error: Servo not calibrated" << std::endl;
+        return false;
+    }
+
+    servoAngles[index] = angle;
+    return true;
+}
+
+int DeviceRegistry::getServoAngle(int index) const {
+    return servoAngles[index];
+}
+
+bool DeviceRegistry::isServoCalibrated(int index) const {
+    return servoCalibrated[index] != 0;
+}
+
+std::string DeviceRegistry::getServoName(int index) const {
+    return std::string(&nameArena[servoNameOffsets[index]]);
+}
+
+bool DeviceRegistry::initializeActuator(int index) {
+    std::cout << "[DeviceRegistry] Initializing actuator "
+              << getActuatorName(index) << "..." << std::endl;
+
+    // Simulate homing procedure
+    actuatorPositions[index] = 0;
+    actuatorStates[index] = Contractor::RETRACTED;
+    actuatorInitialized[index] = 1;
+    return true;
+}
+
+bool DeviceRegistry::extendActuator(int index) {
+    if (!actuatorInitialized[index]) {
+        std::cerr << "[DeviceRegistry] Error: Actuator not initialized" << std::endl;
+        return false;
+    }
+
+    if (actuatorStates[index] == Contractor::EXTENDED) {
+        return true;
+    }
+
+    // Simulate extension
+    actuatorStates[index] = Contractor::EXTENDING;
+    actuatorPositions[index] = 100;
+    actuatorStates[index] = Contractor::EXTENDED;
+    return true;
+}
+
+bool DeviceRegistry::retractActuator(int index) {
+    if (!actuatorInitialized[index]) {
+        std::cerr << "[DeviceRegistry] Error: Actuator not initialized" << std::endl;
+        return false;
+    }
+
+    if (actuatorStates[index] == Contractor::RETRACTED) {
+        return true;
+    }
+
+    // Simulate retraction
+    actuatorStates[index] = Contractor::RETRACTING;
+    actuatorPositions[index] = 0;
+    actuatorStates[index] = Contractor::RETRACTED;
+    return true;
+}
+
+void DeviceRegistry::stopActuator(int index) {
+    std::cout << "[DeviceRegistry] Stopping actuator " << getActuatorName(index)
+              << " at position " << actuatorPositions[index] << "%" << std::endl;
+
+    if (actuatorStates[index] == Contractor::EXTENDING ||
+        actuatorStates[index] == Contractor::RETRACTING) {
+        actuatorStates[index] = (actuatorPositions[index] > 50)
+            ? Contractor::EXTENDED : Contractor::RETRACTED;
+    }
+}
+
+int DeviceRegistry::getActuatorPosition(int index) const {
+    return actuatorPositions[index];
+}
+
+Contractor::State DeviceRegistry::getActuatorState(int index) const {
+    return actuatorStates[index];
+}
+
+bool DeviceRegistry::isActuatorReady(int index) const {
+    return actuatorInitialized[index] != 0 &&
+           actuatorStates[index] != Contractor::ERROR;
+}
+
+std::string DeviceRegistry::getActuatorStateString(int index) const {
+    switch (actuatorStates[index]) {
+        case Contractor::RETRACTED:  return "RETRACTED";
+        case Contractor::EXTENDING:  return "EXTENDING";
+        case Contractor::EXTENDED:   return "EXTENDED";
+        case Contractor::RETRACTING: return "RETRACTING";
+        case Contractor::ERROR:      return "ERROR";
+        default:                     return "UNKNOWN";
+    }
+}
+
+std::string DeviceRegistry::getActuatorName(int index) const {
+    return std::string(&nameArena[actuatorNameOffsets[index]]);
+}
+
+size_t DeviceRegistry::servoCount() const {
+    return servoAngles.size();
+}
+
+size_t DeviceRegistry::actuatorCount() const {
+    return actuatorPositions.size();
+}
@@ -0,0 +1,179 @@
+/**
+ * @file DeviceRegistry.h
+ * @brief Contiguous structure-of-arrays storage for servo and actuator fleets
+ *
+ * This file contains the DeviceRegistry class which owns the hot per-cycle
+ * state of many servos and actuators in parallel arrays, so control loops
+ * iterating over large door fleets touch dense cache lines instead of
+ * chasing per-door heap pointers.
+ */
+
+#ifndef DEVICEREGISTRY_H
+#define DEVICEREGISTRY_H
+
+#include "Contractor.h"
+#include <string>
+#include <vector>
+
+/**
+ * @brief Structure-of-arrays registry for servo and actuator fleets
+ *
+ * The DeviceRegistry owns all servo and actuator state in contiguous
+ * parallel arrays (angles, positions, states), addressed by index.
+ * SmartDoor instances hold indices into the registry instead of
+ * heap-allocated Servo/Contractor objects, so the periodic update loop
+ * over a fleet of doors stays cache-friendly. Device identifiers are
+ * packed into a single string arena to keep cold data out of the hot
+ * arrays.
+ */
+class DeviceRegistry {
+private:
+    // --- Servo state, one entry per servo (structure of arrays) ---
+    std::vector<int> servoAngles;              ///< Current angle per servo (0-180)
+    std::vector<unsigned char> servoCalibrated; ///< Calibration flag per servo
+    std::vector<size_t> servoNameOffsets;      ///< Arena offset of each servo id
+
+    // --- Actuator state, one entry per actuator (structure of arrays) ---
+    std::vector<int> actuatorPositions;        ///< Position percentage per actuator
+    std::vector<Contractor::State> actuatorStates;  ///< State per actuator
+    std::vector<int> actuatorMaxExtensions;    ///< Max extension in mm per actuator
+    std::vector<unsigned char> actuatorInitialized; ///< Init flag per actuator
+    std::vector<size_t> actuatorNameOffsets;   ///< Arena offset of each actuator id
+
+    std::vector<char> nameArena;               ///< Packed NUL-terminated device ids
+
+    /**
+     * @brief Copy an identifier into the name arena
+     * @param id Identifier to store
+     * @return Offset of the stored string within the arena
+     */
+    size_t internName(const std::string& id);
+
+public:
+    /**
+     * @brief Register a new servo
+     * @param servoName Name identifier for the servo
+     * @return Index of the servo within the registry
+     */
+    int addServo(const std::string& servoName);
+
+    /**
+     * @brief Register a new actuator
+     * @param actuatorName Name identifier for the actuator
+     * @param maxExt Maximum extension in millimeters (default 200mm)
+     * @return Index of the actuator within the registry
+     */
+    int addActuator(const std::string& actuatorName, int maxExt = 200);
+
+    /**
+     * @brief Calibrate a servo to its home position
+     * @param index Servo index
+     * @return true if calibration succeeded, false otherwise
+     */
+    bool calibrateServo(int index);
+
+    /**
+     * @brief Set a servo angle
+     * @param index Servo index
+     * @param angle Target angle in degrees (0-180)
+     * @return true if angle was set successfully, false if out of range
+     */
+    bool setServoAngle(int index, int angle);
+
+    /**
+     * @brief Get the current angle of a servo
+     * @param index Servo index
+     * @return Current angle in degrees
+     */
+    int getServoAngle(int index) const;
+
+    /**
+     * @brief Check if a servo is calibrated
+     * @param index Servo index
+     * @return true if calibrated, false otherwise
+     */
+    bool isServoCalibrated(int index) const;
+
+    /**
+     * @brief Get a servo identifier
+     * @param index Servo index
+     * @return Name of the servo
+     */
+    std::string getServoName(int index) const;
+
+    /**
+     * @brief Initialize an actuator and home it to the retracted position
+     * @param index Actuator index
+     * @return true if initialization succeeded, false otherwise
+     */
+    bool initializeActuator(int index);
+
+    /**
+     * @brief Extend an actuator to open the door
+     * @param index Actuator index
+     * @return true if extension succeeded, false otherwise
+     */
+    bool extendActuator(int index);
+
+    /**
+     * @brief Retract an actuator to close the door
+     * @param index Actuator index
+     * @return true if retraction succeeded, false otherwise
+     */
+    bool retractActuator(int index);
+
+    /**
+     * @brief Stop an actuator at its current position
+     * @param index Actuator index
+     */
+    void stopActuator(int index);
+
+    /**
+     * @brief Get the current position of an actuator
+     * @param index Actuator index
+     * @return Current position percentage (0-100)
+     */
+    int getActuatorPosition(int index) const;
+
+    /**
+     * @brief Get the current state of an actuator
+     * @param index Actuator index
+     * @return Current Contractor::State enum value
+     */
+    Contractor::State getActuatorState(int index) const;
+
+    /**
+     * @brief Check if an actuator is initialized and error-free
+     * @param index Actuator index
+     * @return true if ready, false otherwise
+     */
+    bool isActuatorReady(int index) const;
+
+    /**
+     * @brief Get string representation of an actuator state
+     * @param index Actuator index
+     * @return State name as string
+     */
+    std::string getActuatorStateString(int index) const;
+
+    /**
+     * @brief Get an actuator identifier
+     * @param index Actuator index
+     * @return Name of the actuator
+     */
+    std::string getActuatorName(int index) const;
+
+    /**
+     * @brief Get the number of registered servos
+     * @return Servo count
+     */
+    size_t servoCount() const;
+
+    /**
+     * @brief Get the number of registered actuators
+     * @return Actuator count
+     */
+    size_t actuatorCount() const;
+};
+
+#endif // DEVICEREGISTRY_H
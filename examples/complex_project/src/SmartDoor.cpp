@@ -8,7 +8,8 @@
 #include <sstream>
 
 SmartDoor::SmartDoor(const std::string& id)
-    : doorId(id), currentState(CLOSED_LOCKED), isSystemReady(false), openAttempts(0) {
+    : doorId(id), currentState(CLOSED_LOCKED), isSystemReady(false), openAttempts(0),
+      pendingRequest(REQUEST_NONE), registry(nullptr), servoIndex(-1), actuatorIndex(-1) {
     std::cout << "[SmartDoor] Creating smart door system: " << doorId << std::endl;
 
     // Create servo for lock mechanism
@@ -20,6 +21,19 @@ SmartDoor::SmartDoor(const std::string& id)
     std::cout << "[SmartDoor] Components created" << std::endl;
 }
 
+SmartDoor::SmartDoor(const std::string& id, DeviceRegistry* deviceRegistry)
+    : lockServo(nullptr), doorActuator(nullptr), doorId(id), currentState(CLOSED_LOCKED),
+      isSystemReady(false), openAttempts(0), pendingRequest(REQUEST_NONE),
+      registry(deviceRegistry) {
+    std::cout << "[SmartDoor] Creating registry-backed smart door: " << doorId << std::endl;
+
+    // Register devices; only indices into the shared SoA storage are kept
+    servoIndex = registry->addServo("LockServo_" + doorId);
+    actuatorIndex = registry->addActuator("DoorActuator_" + doorId, 250);
+
+    std::cout << "[SmartDoor] Components registered" << std::endl;
+}
+
 SmartDoor::~SmartDoor() {
     std::cout << "[SmartDoor] Shutting down smart door: " << doorId << std::endl;
 
@@ -32,32 +46,90 @@ SmartDoor::~SmartDoor() {
     delete doorActuator;
 }
 
+bool SmartDoor::servoCalibrate() {
+    return registry ? registry->calibrateServo(servoIndex) : lockServo->calibrate();
+}
+
+bool SmartDoor::servoSetAngle(int angle) {
+    telemetry.record(TelemetryRing::SERVO_COMMAND, angle);
+    return registry ? registry->setServoAngle(servoIndex, angle) : lockServo->setAngle(angle);
+}
+
+bool SmartDoor::servoIsCalibrated() const {
+    return registry ? registry->isServoCalibrated(servoIndex) : lockServo->isCalibratedStatus();
+}
+
+int SmartDoor::servoGetAngle() const {
+    return registry ? registry->getServoAngle(servoIndex) : lockServo->getAngle();
+}
+
+std::string SmartDoor::servoGetName() const {
+    return registry ? registry->getServoName(servoIndex) : lockServo->getName();
+}
+
+bool SmartDoor::actuatorInitialize() {
+    return registry ? registry->initializeActuator(actuatorIndex) : doorActuator->initialize();
+}
+
+bool SmartDoor::actuatorExtend() {
+    return registry ? registry->extendActuator(actuatorIndex) : doorActuator->extend();
+}
+
+bool SmartDoor::actuatorRetract() {
+    return registry ? registry->retractActuator(actuatorIndex) : doorActuator->retract();
+}
+
+void SmartDoor::actuatorStop() {
+    if (registry) {
+        registry->stopActuator(actuatorIndex);
+    } else {
+        doorActuator->stop();
+    }
+}
+
+int SmartDoor::actuatorGetPosition() const {
+    return registry ? registry->getActuatorPosition(actuatorIndex) : doorActuator->getPosition();
+}
+
+bool SmartDoor::actuatorIsReady() const {
+    return registry ? registry->isActuatorReady(actuatorIndex) : doorActuator->isReady();
+}
+
+std::string SmartDoor::actuatorGetStateString() const {
+    return registry ? registry->getActuatorStateString(actuatorIndex)
+                    : doorActuator->getStateString();
+}
+
+std::string SmartDoor::actuatorGetName() const {
+    return registry ? registry->getActuatorName(actuatorIndex) : doorActuator->getName();
+}
+
 bool SmartDoor::initialize() {
     std::cout << "[SmartDoor] Initializing system..." << std::endl;
 
     // Calibrate servo
-    if (!lockServo->calibrate()) {
+    if (!servoCalibrate()) {
         std::cerr << "[SmartDoor] Error: Servo calibration failed" << std::endl;
-        currentState = ERROR_STATE;
+        transitionTo(ERROR_STATE);
         return false;
     }
 
     // Initialize contractor
-    if (!doorActuator->initialize()) {
+    if (!actuatorInitialize()) {
         std::cerr << "[SmartDoor] Error: Contractor initialization failed" << std::endl;
-        currentState = ERROR_STATE;
+        transitionTo(ERROR_STATE);
         return false;
     }
 
     // Lock the door by default
     if (!lockDoor()) {
         std::cerr << "[SmartDoor] Error: Initial lock failed" << std::endl;
-        currentState = ERROR_STATE;
+        transitionTo(ERROR_STATE);
         return false;
     }
 
     isSystemReady = true;
-    currentState = CLOSED_LOCKED;
+    transitionTo(CLOSED_LOCKED);
     openAttempts = 0;
 
     std::cout << "[SmartDoor] Initialization complete - System ready" << std::endl;
@@ -68,7 +140,7 @@ bool SmartDoor::lockDoor() {
     std::cout << "[SmartDoor] Locking door..." << std::endl;
 
     // Move servo to locked position (0 degrees)
-    if (!lockServo->setAngle(0)) {
+    if (!servoSetAngle(0)) {
         std::cerr << "[SmartDoor] Error: Failed to lock" << std::endl;
         return false;
     }
@@ -81,7 +153,7 @@ bool SmartDoor::unlockDoor() {
     std::cout << "[SmartDoor] Unlocking door..." << std::endl;
 
     // Move servo to unlocked position (90 degrees)
-    if (!lockServo->setAngle(90)) {
+    if (!servoSetAngle(90)) {
         std::cerr << "[SmartDoor] Error: Failed to unlock" << std::endl;
         return false;
     }
@@ -101,12 +173,12 @@ bool SmartDoor::isSafeToOperate() const {
         return false;
     }
 
-    if (!lockServo->isCalibratedStatus()) {
+    if (!servoIsCalibrated()) {
         std::cerr << "[SmartDoor] Servo not calibrated" << std::endl;
         return false;
     }
 
-    if (!doorActuator->isReady()) {
+    if (!actuatorIsReady()) {
         std::cerr << "[SmartDoor] Contractor not ready" << std::endl;
         return false;
     }
@@ -120,8 +192,9 @@ bool SmartDoor::open() {
     if (!isSafeToOperate()) {
         std::cerr << "[SmartDoor] Error: Not safe to operate" << std::endl;
         openAttempts++;
+        telemetry.record(TelemetryRing::OPEN_ATTEMPT, openAttempts);
         if (openAttempts >= MAX_ATTEMPTS) {
-            currentState = ERROR_STATE;
+            transitionTo(ERROR_STATE);
         }
         return false;
     }
@@ -131,25 +204,25 @@ bool SmartDoor::open() {
         return true;
     }
 
-    currentState = OPENING;
+    transitionTo(OPENING);
 
     // Step 1: Unlock the door
     if (!unlockDoor()) {
         std::cerr << "[SmartDoor] Error: Failed to unlock" << std::endl;
-        currentState = ERROR_STATE;
+        transitionTo(ERROR_STATE);
         return false;
     }
 
-    currentState = CLOSED_UNLOCKED;
+    transitionTo(CLOSED_UNLOCKED);
 
     // Step 2: Extend contractor to push door open
-    if (!doorActuator->extend()) {
+    if (!actuatorExtend()) {
         std::cerr << "[SmartDoor] Error: Failed to extend actuator" << std::endl;
-        currentState = ERROR_STATE;
+        transitionTo(ERROR_STATE);
         return false;
     }
 
-    currentState = OPEN;
+    transitionTo(OPEN);
     openAttempts = 0;
 
     std::cout << "[SmartDoor] === Door successfully opened ===" << std::endl;
@@ -169,43 +242,170 @@ bool SmartDoor::close() {
         return true;
     }
 
-    currentState = CLOSING;
+    transitionTo(CLOSING);
 
     // Step 1: Retract contractor to close door
-    if (!doorActuator->retract()) {
+    if (!actuatorRetract()) {
         std::cerr << "[SmartDoor] Error: Failed to retract actuator" << std::endl;
-        currentState = ERROR_STATE;
+        transitionTo(ERROR_STATE);
         return false;
     }
 
-    currentState = CLOSED_UNLOCKED;
+    transitionTo(CLOSED_UNLOCKED);
 
     // Step 2: Lock the door
     if (!lockDoor()) {
         std::cerr << "[SmartDoor] Error: Failed to lock" << std::endl;
-        currentState = ERROR_STATE;
+        transitionTo(ERROR_STATE);
         return false;
     }
 
-    currentState = CLOSED_LOCKED;
+    transitionTo(CLOSED_LOCKED);
 
     std::cout << "[SmartDoor] === Door successfully closed and locked ===" << std::endl;
     return true;
 }
 
+bool SmartDoor::requestOpen() {
+    if (!isSafeToOperate()) {
+        std::cerr << "[SmartDoor] Error: Cannot queue open request" << std::endl;
+        return false;
+    }
+
+    if (currentState == OPEN) {
+        std::cout << "[SmartDoor] Door already open - nothing to queue" << std::endl;
+        pendingRequest = REQUEST_NONE;
+        return true;
+    }
+
+    std::cout << "[SmartDoor] Open request queued" << std::endl;
+    pendingRequest = REQUEST_OPEN;
+    return true;
+}
+
+bool SmartDoor::requestClose() {
+    if (!isSafeToOperate()) {
+        std::cerr << "[SmartDoor] Error: Cannot queue close request" << std::endl;
+        return false;
+    }
+
+    if (currentState == CLOSED_LOCKED) {
+        std::cout << "[SmartDoor] Door already closed and locked - nothing to queue" << std::endl;
+        pendingRequest = REQUEST_NONE;
+        return true;
+    }
+
+    std::cout << "[SmartDoor] Close request queued" << std::endl;
+    pendingRequest = REQUEST_CLOSE;
+    return true;
+}
+
+bool SmartDoor::tick() {
+    if (pendingRequest == REQUEST_NONE) {
+        return true;
+    }
+
+    if (!isSafeToOperate()) {
+        std::cerr << "[SmartDoor] Error: Not safe to operate" << std::endl;
+        pendingRequest = REQUEST_NONE;
+        openAttempts++;
+        telemetry.record(TelemetryRing::OPEN_ATTEMPT, openAttempts);
+        if (openAttempts >= MAX_ATTEMPTS) {
+            transitionTo(ERROR_STATE);
+        }
+        return false;
+    }
+
+    // One component action per tick keeps per-tick latency bounded
+    if (pendingRequest == REQUEST_OPEN) {
+        switch (currentState) {
+            case CLOSED_LOCKED:
+                if (!unlockDoor()) {
+                    transitionTo(ERROR_STATE);
+                    pendingRequest = REQUEST_NONE;
+                    return false;
+                }
+                transitionTo(OPENING);
+                return true;
+
+            case OPENING:
+            case CLOSED_UNLOCKED:
+            case CLOSING:
+                if (!actuatorExtend()) {
+                    std::cerr << "[SmartDoor] Error: Failed to extend actuator" << std::endl;
+                    transitionTo(ERROR_STATE);
+                    pendingRequest = REQUEST_NONE;
+                    return false;
+                }
+                transitionTo(OPEN);
+                openAttempts = 0;
+                pendingRequest = REQUEST_NONE;
+                std::cout << "[SmartDoor] Open request completed" << std::endl;
+                return true;
+
+            case OPEN:
+                pendingRequest = REQUEST_NONE;
+                return true;
+
+            default:
+                pendingRequest = REQUEST_NONE;
+                return false;
+        }
+    }
+
+    // pendingRequest == REQUEST_CLOSE
+    switch (currentState) {
+        case OPEN:
+        case OPENING:
+            if (!actuatorRetract()) {
+                std::cerr << "[SmartDoor] Error: Failed to retract actuator" << std::endl;
+                transitionTo(ERROR_STATE);
+                pendingRequest = REQUEST_NONE;
+                return false;
+            }
+            transitionTo(CLOSING);
+            return true;
+
+        case CLOSING:
+        case CLOSED_UNLOCKED:
+            if (!lockDoor()) {
+                transitionTo(ERROR_STATE);
+                pendingRequest = REQUEST_NONE;
+                return false;
+            }
+            transitionTo(CLOSED_LOCKED);
+            pendingRequest = REQUEST_NONE;
+            std::cout << "[SmartDoor] Close request completed" << std::endl;
+            return true;
+
+        case CLOSED_LOCKED:
+            pendingRequest = REQUEST_NONE;
+            return true;
+
+        default:
+            pendingRequest = REQUEST_NONE;
+            return false;
+    }
+}
+
+bool SmartDoor::hasPendingRequest() const {
+    return pendingRequest != REQUEST_NONE;
+}
+
 void SmartDoor::emergencyStop() {
     std::cout << "[SmartDoor] !!! EMERGENCY STOP ACTIVATED !!!" << std::endl;
 
-    // Stop all movement
-    doorActuator->stop();
+    // Cancel any queued operation and stop all movement
+    pendingRequest = REQUEST_NONE;
+    actuatorStop();
 
     // Set safe state
-    if (doorActuator->getPosition() > 50) {
+    if (actuatorGetPosition() > 50) {
         // Door is mostly open
-        currentState = OPEN;
+        transitionTo(OPEN);
     } else {
         // Door is mostly closed
-        currentState = CLOSED_UNLOCKED;
+        transitionTo(CLOSED_UNLOCKED);
     }
 
     std::cout << "[SmartDoor] System halted in state: " << getStateString() << std::endl;
@@ -245,22 +445,73 @@ std::string SmartDoor::getStatusReport() const {
     report << std::endl;
 
     report << "--- Servo Lock ---" << std::endl;
-    report << "Name: " << lockServo->getName() << std::endl;
-    report << "Angle: " << lockServo->getAngle() << " degrees" << std::endl;
-    report << "Calibrated: " << (lockServo->isCalibratedStatus() ? "Yes" : "No") << std::endl;
+    report << "Name: " << servoGetName() << std::endl;
+    report << "Angle: " << servoGetAngle() << " degrees" << std::endl;
+    report << "Calibrated: " << (servoIsCalibrated() ? "Yes" : "No") << std::endl;
     report << std::endl;
 
     report << "--- Door Actuator ---" << std::endl;
-    report << "Name: " << doorActuator->getName() << std::endl;
-    report << "State: " << doorActuator->getStateString() << std::endl;
-    report << "Position: " << doorActuator->getPosition() << "%" << std::endl;
-    report << "Ready: " << (doorActuator->isReady() ? "Yes" : "No") << std::endl;
+    report << "Name: " << actuatorGetName() << std::endl;
+    report << "State: " << actuatorGetStateString() << std::endl;
+    report << "Position: " << actuatorGetPosition() << "%" << std::endl;
+    report << "Ready: " << (actuatorIsReady() ? "Yes" : "No") << std::endl;
 
     report << "=============================" << std::endl;
 
     return report.str();
 }
 
+void SmartDoor::transitionTo(DoorState newState) {
+    telemetry.record(TelemetryRing::STATE_TRANSITION, newState);
+    currentState = newState;
+}
+
+bool SmartDoor::drainTelemetryEvent(TelemetryRing::Event& event) {
+    return telemetry.pop(event);
+}
+
+std::string SmartDoor::exportTrace() {
+    std::ostringstream trace;
+    TelemetryRing::Event event;
+
+    trace << "=== Telemetry Trace: " << doorId << " ===" << std::endl;
+
+    while (telemetry.pop(event)) {
+        trace << event.timestampNs << " ns  ";
+        switch (event.type) {
+            case TelemetryRing::STATE_TRANSITION: {
+                DoorState state = static_cast<DoorState>(event.value);
+                trace << "STATE_TRANSITION -> ";
+                switch (state) {
+                    case CLOSED_LOCKED:   trace << "CLOSED_LOCKED"; break;
+                    case CLOSED_UNLOCKED: trace << "CLOSED_UNLOCKED"; break;
+                    case OPENING:         trace << "OPENING"; break;
+                    case OPEN:            trace << "OPEN"; break;
+                    case CLOSING:         trace << "CLOSING"; break;
+                    case ERROR_STATE:     trace << "ERROR_STATE"; break;
+                    default:              trace << "UNKNOWN"; break;
+                }
+                break;
+            }
+            case TelemetryRing::SERVO_COMMAND:
+                trace << "SERVO_COMMAND angle=" << event.value;
+                break;
+            case TelemetryRing::OPEN_ATTEMPT:
+                trace << "OPEN_ATTEMPT count=" << event.value;
+                break;
+            default:
+                trace << "UNKNOWN value=" << event.value;
+                break;
+        }
+        trace << std::endl;
+    }
+
+    trace << "Dropped events: " << telemetry.droppedCount() << std::endl;
+    trace << "==============================" << std::endl;
+
+    return trace.str();
+}
+
 bool SmartDoor::reset() {
     std::cout << "[SmartDoor] Resetting system..." << std::endl;
 
@@ -12,6 +12,8 @@
 
 #include "Servo.h"
 #include "Contractor.h"
+#include "DeviceRegistry.h"
+#include "TelemetryRing.h"
 #include <string>
 
 /**
@@ -35,15 +37,39 @@ public:
         ERROR_STATE       ///< Error condition
     };
 
+    /**
+     * @brief Pending asynchronous request enumeration
+     */
+    enum PendingRequest {
+        REQUEST_NONE,     ///< No operation requested
+        REQUEST_OPEN,     ///< Open operation queued
+        REQUEST_CLOSE     ///< Close operation queued
+    };
+
 private:
-    Servo* lockServo;              ///< Servo controlling the lock mechanism
-    Contractor* doorActuator;      ///< Linear actuator for door movement
+    Servo* lockServo;              ///< Servo controlling the lock mechanism (pointer mode)
+    Contractor* doorActuator;      ///< Linear actuator for door movement (pointer mode)
+    DeviceRegistry* registry;      ///< Shared device registry (registry mode), or nullptr
+    int servoIndex;                ///< Lock servo index within the registry
+    int actuatorIndex;             ///< Door actuator index within the registry
     DoorState currentState;        ///< Current state of the door
     bool isSystemReady;            ///< System initialization status
     std::string doorId;            ///< Identifier for this door
     int openAttempts;              ///< Counter for failed open attempts
+    PendingRequest pendingRequest; ///< Queued asynchronous operation
+    TelemetryRing telemetry;       ///< Flight recorder for hot-path events
     static const int MAX_ATTEMPTS = 3;  ///< Maximum retry attempts
 
+    /**
+     * @brief Change the door state and record the transition
+     *
+     * Every state change on the hot path goes through this helper so the
+     * telemetry ring captures a timestamped trace without print calls.
+     *
+     * @param newState State to transition to
+     */
+    void transitionTo(DoorState newState);
+
     /**
      * @brief Lock the door using servo
      * @return true if locking succeeded, false otherwise
@@ -62,6 +88,36 @@ private:
      */
     bool isSafeToOperate() const;
 
+    // Device access helpers that dispatch to the registry when one is
+    // attached, or to the owned Servo/Contractor objects otherwise.
+
+    /// @brief Calibrate the lock servo
+    bool servoCalibrate();
+    /// @brief Set the lock servo angle
+    bool servoSetAngle(int angle);
+    /// @brief Check lock servo calibration status
+    bool servoIsCalibrated() const;
+    /// @brief Get the lock servo angle
+    int servoGetAngle() const;
+    /// @brief Get the lock servo name
+    std::string servoGetName() const;
+    /// @brief Initialize the door actuator
+    bool actuatorInitialize();
+    /// @brief Extend the door actuator
+    bool actuatorExtend();
+    /// @brief Retract the door actuator
+    bool actuatorRetract();
+    /// @brief Stop the door actuator
+    void actuatorStop();
+    /// @brief Get the door actuator position
+    int actuatorGetPosition() const;
+    /// @brief Check door actuator readiness
+    bool actuatorIsReady() const;
+    /// @brief Get the door actuator state name
+    std::string actuatorGetStateString() const;
+    /// @brief Get the door actuator name
+    std::string actuatorGetName() const;
+
 public:
     /**
      * @brief Constructor for SmartDoor
@@ -69,6 +125,20 @@ public:
      */
     SmartDoor(const std::string& id);
 
+    /**
+     * @brief Constructor for SmartDoor backed by a shared device registry
+     *
+     * Instead of heap-allocating its own Servo and Contractor, the door
+     * registers its devices in the given DeviceRegistry and keeps only
+     * indices into its structure-of-arrays storage. Fleets of doors built
+     * this way share contiguous hot state, so the periodic control loop
+     * iterates dense cache lines rather than chasing per-door pointers.
+     *
+     * @param id Identifier for the door
+     * @param deviceRegistry Registry that owns the servo and actuator state
+     */
+    SmartDoor(const std::string& id, DeviceRegistry* deviceRegistry);
+
     /**
      * @brief Destructor for SmartDoor
      */
@@ -102,6 +172,48 @@ public:
      */
     bool close();
 
+    /**
+     * @brief Request an asynchronous door open
+     *
+     * Queues the open intent without moving any hardware. The operation
+     * is carried out step by step by subsequent tick() calls, so a single
+     * control thread can multiplex many doors. A queued close request is
+     * replaced by the new intent.
+     *
+     * @return true if the request was accepted, false if the system is not ready
+     */
+    bool requestOpen();
+
+    /**
+     * @brief Request an asynchronous door close
+     *
+     * Queues the close intent without moving any hardware. The operation
+     * is carried out step by step by subsequent tick() calls. A queued
+     * open request is replaced by the new intent.
+     *
+     * @return true if the request was accepted, false if the system is not ready
+     */
+    bool requestClose();
+
+    /**
+     * @brief Advance the door state machine by one bounded step
+     *
+     * Performs at most one component action (servo move or actuator
+     * extend/retract) per call, so per-tick latency stays bounded and a
+     * single thread can service hundreds of doors in a loop. Call
+     * repeatedly until hasPendingRequest() returns false.
+     *
+     * @return true if the state machine made progress or is idle,
+     *         false if a step failed and the door entered ERROR_STATE
+     */
+    bool tick();
+
+    /**
+     * @brief Check whether an asynchronous operation is still in progress
+     * @return true if a request is queued or being executed, false when idle
+     */
+    bool hasPendingRequest() const;
+
     /**
      * @brief Emergency stop - halt all operations immediately
      *
@@ -150,6 +262,28 @@ public:
      * @return true if reset succeeded, false otherwise
      */
     bool reset();
+
+    /**
+     * @brief Drain one telemetry event (background reader side)
+     *
+     * Intended to be called from a background thread that periodically
+     * empties each door's ring without disturbing the control loop.
+     *
+     * @param event Filled with the oldest recorded event on success
+     * @return true if an event was drained, false if the ring was empty
+     */
+    bool drainTelemetryEvent(TelemetryRing::Event& event);
+
+    /**
+     * @brief Export the buffered telemetry trace for post-mortem analysis
+     *
+     * Drains every buffered event and formats it as one line per event
+     * with its timestamp, kind and decoded payload, followed by the
+     * count of events dropped while the ring was full.
+     *
+     * @return Human-readable trace dump as string
+     */
+    std::string exportTrace();
 };
 
 #endif // SMARTDOOR_H
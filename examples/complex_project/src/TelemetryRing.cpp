@@ -0,0 +1,57 @@
+/**
+ * @file TelemetryRing.cpp
+ * @brief Implementation of TelemetryRing class
+ */
+
+#include "TelemetryRing.h"
+#include <chrono>
+
+TelemetryRing::TelemetryRing()
+    : head(0), tail(0), dropped(0) {
+}
+
+unsigned long long TelemetryRing::nowNanoseconds() {
+    return static_cast<unsigned long long>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void TelemetryRing::record(EventType type, int value) {
+    size_t writeIndex = head.load(std::memory_order_relaxed);
+    size_t readIndex = tail.load(std::memory_order_acquire);
+
+    if (writeIndex - readIndex >= CAPACITY) {
+        // Ring full: drop rather than block the control loop
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    Event& slot = events[writeIndex & (CAPACITY - 1)];
+    slot.timestampNs = nowNanoseconds();
+    slot.type = type;
+    slot.value = value;
+
+    // Publish the slot to the consumer
+    head.store(writeIndex + 1, std::memory_order_release);
+}
+
+bool TelemetryRing::pop(Event& event) {
+    size_t readIndex = tail.load(std::memory_order_relaxed);
+    size_t writeIndex = head.load(std::memory_order_acquire);
+
+    if (readIndex == writeIndex) {
+        return false;
+    }
+
+    event = events[readIndex & (CAPACITY - 1)];
+    tail.store(readIndex + 1, std::memory_order_release);
+    return true;
+}
+
+size_t TelemetryRing::size() const {
+    return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+}
+
+size_t TelemetryRing::droppedCount() const {
+    return dropped.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,98 @@
+/**
+ * @file TelemetryRing.h
+ * @brief Lock-free fixed-size ring buffer for hot-path telemetry events
+ *
+ * This file contains the TelemetryRing class, a single-producer
+ * single-consumer ring buffer used as a flight recorder for SmartDoor
+ * state transitions. Recording an event costs one array write and one
+ * atomic store with no allocation, so it is safe to use inside the
+ * control loop.
+ */
+
+#ifndef TELEMETRYRING_H
+#define TELEMETRYRING_H
+
+#include <atomic>
+#include <cstddef>
+
+/**
+ * @brief Lock-free single-producer single-consumer telemetry ring buffer
+ *
+ * The ring holds a fixed number of timestamped events in a preallocated
+ * array. The control loop (producer) records events with record();
+ * a background reader (consumer) drains them with pop(). When the ring
+ * is full the newest event is dropped and counted, so the producer
+ * never blocks and never allocates.
+ */
+class TelemetryRing {
+public:
+    /**
+     * @brief Kind of recorded event
+     */
+    enum EventType {
+        STATE_TRANSITION,  ///< DoorState changed; value is the new state
+        SERVO_COMMAND,     ///< Servo angle commanded; value is the angle
+        OPEN_ATTEMPT       ///< Failed open attempt; value is the attempt count
+    };
+
+    /**
+     * @brief One recorded telemetry event
+     */
+    struct Event {
+        unsigned long long timestampNs;  ///< Monotonic timestamp in nanoseconds
+        EventType type;                  ///< Kind of event
+        int value;                       ///< Event payload (state, angle or count)
+    };
+
+    /// Ring capacity; power of two so indices wrap with a mask
+    static const size_t CAPACITY = 256;
+
+    /**
+     * @brief Constructor for TelemetryRing
+     */
+    TelemetryRing();
+
+    /**
+     * @brief Record an event (producer side, hot path)
+     *
+     * Lock-free and allocation-free. If the ring is full the event is
+     * dropped and the drop counter is incremented instead of blocking.
+     *
+     * @param type Kind of event to record
+     * @param value Event payload
+     */
+    void record(EventType type, int value);
+
+    /**
+     * @brief Remove the oldest event (consumer side)
+     * @param event Filled with the oldest event on success
+     * @return true if an event was popped, false if the ring was empty
+     */
+    bool pop(Event& event);
+
+    /**
+     * @brief Get the number of events currently buffered
+     * @return Buffered event count
+     */
+    size_t size() const;
+
+    /**
+     * @brief Get the number of events dropped because the ring was full
+     * @return Dropped event count
+     */
+    size_t droppedCount() const;
+
+private:
+    Event events[CAPACITY];           ///< Preallocated event storage
+    std::atomic<size_t> head;         ///< Next slot to write (producer)
+    std::atomic<size_t> tail;         ///< Next slot to read (consumer)
+    std::atomic<size_t> dropped;      ///< Events lost to a full ring
+
+    /**
+     * @brief Get a monotonic timestamp
+     * @return Nanoseconds from a monotonic clock
+     */
+    static unsigned long long nowNanoseconds();
+};
+
+#endif // TELEMETRYRING_H
@@ -24,6 +24,7 @@ __license__ = "Apache-2.0"
 
 # Import main classes for public API
 from introligo.__main__ import main
+from introligo.anchor_registry import AnchorRegistry
 from introligo.errors import IntroligoError
 from introligo.generator import IntroligoGenerator
 from introligo.markdown_converter import (
@@ -32,14 +33,18 @@ from introligo.markdown_converter import (
     convert_markdown_to_rst,
 )
 from introligo.page_node import PageNode
+from introligo.profiler import Profiler
 from introligo.utils import count_display_width, slugify
-from introligo.yaml_loader import IncludeLoader, include_constructor
+from introligo.yaml_loader import IncludeLoader, get_include_loader, include_constructor
 
 __all__ = [
+    "AnchorRegistry",
     "IntroligoGenerator",
     "IntroligoError",
     "PageNode",
+    "Profiler",
     "IncludeLoader",
+    "get_include_loader",
     "include_constructor",
     "main",
     "slugify",
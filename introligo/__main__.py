@@ -140,7 +140,9 @@ Usage:
 import argparse
 import logging
 import sys
+import time
 from pathlib import Path
+from typing import Dict, List, Set
 
 # Support both direct execution and package import
 if __name__ == "__main__" and __package__ is None:
@@ -149,11 +151,15 @@ if __name__ == "__main__" and __package__ is None:
     from introligo.colored_formatter import ColoredFormatter
     from introligo.errors import IntroligoError
     from introligo.generator import IntroligoGenerator
+    from introligo.profiler import Profiler
+    from introligo.yaml_loader import clear_include_cache, get_cached_include_paths
 else:
     # Package import
     from .colored_formatter import ColoredFormatter
     from .errors import IntroligoError
     from .generator import IntroligoGenerator
+    from .profiler import Profiler
+    from .yaml_loader import clear_include_cache, get_cached_include_paths
 
 # Configure logging with colored output
 handler = logging.StreamHandler()
@@ -162,6 +168,98 @@ logging.basicConfig(level=logging.WARNING, handlers=[handler])
 logger = logging.getLogger(__name__)
 
 
+def collect_watched_files(generator: "IntroligoGenerator") -> Set[Path]:
+    """Collect every input file whose change should trigger a rebuild.
+
+    Covers the main config file, every file pulled in through the YAML
+    !include graph, every content file referenced by the include_* helpers
+    during the last build, and the custom template if one is used.
+
+    Args:
+        generator: Generator from the most recent build.
+
+    Returns:
+        Set of resolved file paths to watch.
+    """
+    watched = {generator.paths.config_file.resolve()}
+    if generator.paths.template_file:
+        watched.add(generator.paths.template_file.resolve())
+    watched.update(path.resolve() for path in get_cached_include_paths())
+    watched.update(Path(key_path) for key_path, _, _ in generator._include_file_cache)
+    return watched
+
+
+def snapshot_mtimes(files: Set[Path]) -> Dict[Path, int]:
+    """Record the current mtimes of the watched files.
+
+    Args:
+        files: Paths to snapshot.
+
+    Returns:
+        Mapping of path to mtime in nanoseconds (-1 if missing).
+    """
+    snapshot = {}
+    for path in files:
+        try:
+            snapshot[path] = path.stat().st_mtime_ns
+        except OSError:
+            snapshot[path] = -1
+    return snapshot
+
+
+def _watch_loop(args: argparse.Namespace, generator: "IntroligoGenerator") -> None:
+    """Poll watched inputs and rebuild affected pages on change.
+
+    Rebuilds run with the incremental manifest, so only pages whose
+    fingerprints changed are re-rendered, and the differential writer only
+    touches files whose content actually differs.
+
+    Args:
+        args: Parsed command-line arguments.
+        generator: Generator from the initial build.
+    """
+    interval = args.watch_interval
+    logger.info(f"👀 Watching for changes (poll every {interval}s, Ctrl+C to stop)")
+
+    while True:
+        watched = collect_watched_files(generator)
+        snapshot = snapshot_mtimes(watched)
+
+        changed: List[Path] = []
+        try:
+            while not changed:
+                time.sleep(interval)
+                current = snapshot_mtimes(watched)
+                changed = [path for path in watched if snapshot[path] != current[path]]
+        except KeyboardInterrupt:
+            logger.info("👋 Watch mode stopped")
+            return
+
+        for path in changed:
+            logger.info(f"  🔄 Changed: {path}")
+
+        # Drop cached include parses so edited fragments are re-read, then
+        # rebuild; unchanged pages are skipped via the incremental manifest
+        clear_include_cache()
+        generator = IntroligoGenerator(
+            config_file=args.config,
+            output_dir=args.output,
+            template_file=args.template,
+            strict=args.strict,
+            incremental=True,
+            jobs=args.jobs,
+        )
+        try:
+            start = time.perf_counter()
+            generator.write_files(generator.generate_all())
+            elapsed = time.perf_counter() - start
+            logger.info(f"✅ Rebuilt in {elapsed:.2f}s")
+        except IntroligoError as e:
+            logger.error(f"Rebuild failed: {e}")
+        except Exception as e:
+            logger.error(f"Unexpected error during rebuild: {e}")
+
+
 def main() -> None:
     """Main entry point for the Introligo command-line tool.
 
@@ -188,6 +286,46 @@ Examples:
     parser.add_argument(
         "--strict", action="store_true", help="Fail immediately if any page fails to generate"
     )
+    parser.add_argument(
+        "--incremental",
+        action="store_true",
+        help="Skip re-rendering pages whose inputs are unchanged since the last run",
+    )
+    parser.add_argument(
+        "--stream",
+        action="store_true",
+        help="Write each page as soon as it renders to bound peak memory on large configs",
+    )
+    parser.add_argument(
+        "--watch",
+        action="store_true",
+        help="Stay resident after the first build and rebuild affected pages on input changes",
+    )
+    parser.add_argument(
+        "--watch-interval",
+        type=float,
+        default=1.0,
+        metavar="SECONDS",
+        help="Polling interval for --watch (default: 1.0)",
+    )
+    parser.add_argument(
+        "--profile",
+        action="store_true",
+        help="Record per-phase and per-page timings and print a summary after the run",
+    )
+    parser.add_argument(
+        "--profile-json",
+        type=Path,
+        metavar="FILE",
+        help="Write raw profiling data as JSON to FILE (implies --profile)",
+    )
+    parser.add_argument(
+        "-j",
+        "--jobs",
+        type=int,
+        default=1,
+        help="Number of worker threads for page rendering (0 = one per CPU, default: 1)",
+    )
     parser.add_argument("-v", "--verbose", action="store_true", help="Enable verbose output")
 
     args = parser.parse_args()
@@ -195,6 +333,16 @@ Examples:
     if args.verbose:
         logging.getLogger().setLevel(logging.INFO)
 
+    if args.watch:
+        if args.dry_run:
+            parser.error("--watch cannot be combined with --dry-run")
+        # Rebuilds rely on the incremental manifest to skip unchanged pages,
+        # and a silent resident process is not useful
+        args.incremental = True
+        logging.getLogger().setLevel(logging.INFO)
+
+    profiler = Profiler() if (args.profile or args.profile_json) else None
+
     try:
         generator = IntroligoGenerator(
             config_file=args.config,
@@ -202,9 +350,16 @@ Examples:
             template_file=args.template,
             dry_run=args.dry_run,
             strict=args.strict,
+            incremental=args.incremental,
+            jobs=args.jobs,
+            profiler=profiler,
         )
-        generated_files = generator.generate_all()
-        generator.write_files(generated_files)
+        if args.stream:
+            file_count = generator.generate_and_write()
+        else:
+            generated_files = generator.generate_all()
+            generator.write_files(generated_files)
+            file_count = len(generated_files)
 
         # Generate and write Breathe configuration if Doxygen is configured
         breathe_config = generator.generate_breathe_config()
@@ -245,11 +400,20 @@ To modify the documentation:
                 )
 
         if not args.dry_run:
-            logger.info(f"Successfully generated {len(generated_files)} RST files!")
+            logger.info(f"Successfully generated {file_count} RST files!")
             logger.info(f"Output directory: {args.output}")
             logger.info("Run 'sphinx-build' or your preview script to build HTML")
         else:
-            logger.info(f"Dry run complete - would generate {len(generated_files)} files")
+            logger.info(f"Dry run complete - would generate {file_count} files")
+
+        if profiler:
+            print(profiler.report())
+            if args.profile_json:
+                profiler.save_json(args.profile_json)
+                logger.info(f"Profile data written to {args.profile_json}")
+
+        if args.watch:
+            _watch_loop(args, generator)
 
     except IntroligoError as e:
         logger.error(f"Error: {e}")
@@ -0,0 +1,109 @@
+#!/usr/bin/env python
+"""Generation-wide slug and anchor registry for cross-page link resolution.
+
+Copyright (c) 2025 WT Tech Jakub Brzezowski
+"""
+
+import logging
+from pathlib import Path
+from typing import Dict, List, Optional, Tuple
+
+from .markdown_converter import create_label_from_title
+
+logger = logging.getLogger(__name__)
+
+
+class AnchorRegistry:
+    """Registry of page slugs and heading labels built once per generation.
+
+    The registry is populated while the page tree is built, so link
+    resolution and duplicate-slug detection during rendering become O(1)
+    dictionary lookups instead of repeated slug recomputation, and doc
+    links can be validated without a second pass over all output.
+    """
+
+    def __init__(self) -> None:
+        """Initialize an empty registry."""
+        self._pages_by_slug: Dict[str, str] = {}
+        self._pages_by_id: Dict[str, Path] = {}
+        self._heading_labels: Dict[Tuple[str, str], str] = {}
+        self._duplicate_slugs: List[str] = []
+
+    def register_page(self, page_id: str, slug: str, output_file: Path) -> bool:
+        """Register a page's slug and output location.
+
+        Args:
+            page_id: Unique identifier of the page.
+            slug: Slug used for the page's RST filename.
+            output_file: Path of the generated RST file.
+
+        Returns:
+            True if the slug was new, False if it duplicates another page.
+        """
+        self._pages_by_id[page_id] = output_file
+        if slug in self._pages_by_slug:
+            self._duplicate_slugs.append(slug)
+            return False
+        self._pages_by_slug[slug] = page_id
+        return True
+
+    def register_heading(self, source: str, heading: str) -> str:
+        """Register a heading of a source document and return its RST label.
+
+        Headings are keyed by their computed label, so lookups work both
+        with the original title text and with anchor-style slugs
+        (``#getting-started``) found in markdown links.
+
+        Args:
+            source: Source path (or page id) the heading belongs to.
+            heading: Heading title text.
+
+        Returns:
+            Final RST label for the heading.
+        """
+        label = create_label_from_title(heading)
+        self._heading_labels[(source, label)] = label
+        return label
+
+    def resolve_page(self, slug: str) -> Optional[str]:
+        """Resolve a slug to the id of the page that owns it.
+
+        Args:
+            slug: Page slug to look up.
+
+        Returns:
+            Page id, or None if no page uses the slug.
+        """
+        return self._pages_by_slug.get(slug)
+
+    def resolve_heading(self, source: str, heading: str) -> Optional[str]:
+        """Resolve a (source, heading) pair to its registered RST label.
+
+        Args:
+            source: Source path (or page id) the heading belongs to.
+            heading: Heading title text or anchor-style slug.
+
+        Returns:
+            Registered RST label, or None if the heading is unknown.
+        """
+        return self._heading_labels.get((source, create_label_from_title(heading)))
+
+    def get_output_file(self, page_id: str) -> Optional[Path]:
+        """Get the output RST path registered for a page.
+
+        Args:
+            page_id: Unique identifier of the page.
+
+        Returns:
+            Output path, or None if the page is unknown.
+        """
+        return self._pages_by_id.get(page_id)
+
+    @property
+    def duplicate_slugs(self) -> List[str]:
+        """Slugs registered by more than one page."""
+        return list(self._duplicate_slugs)
+
+    def __len__(self) -> int:
+        """Number of registered pages."""
+        return len(self._pages_by_id)
@@ -4,24 +4,32 @@
 Copyright (c) 2025 WT Tech Jakub Brzezowski
 """
 
+from __future__ import annotations
+
+import hashlib
+import json
 import logging
+import os
+import sys
+from collections import deque
+from concurrent.futures import ThreadPoolExecutor
+from contextlib import nullcontext
+from copy import deepcopy
 from dataclasses import dataclass
+from functools import lru_cache
+from itertools import islice
 from pathlib import Path
-from typing import Any, Dict, List, Optional, Tuple
+from typing import TYPE_CHECKING, Any, Dict, Iterator, List, Optional, Tuple
 
 import yaml
-from jinja2 import Environment, Template
 
+from .anchor_registry import AnchorRegistry
 from .errors import IntroligoError
-from .godoc_extractor import GoDocExtractor
-from .javadoc_extractor import JavaDocExtractor
 from .markdown_converter import (
     convert_markdown_to_rst,
 )
 from .page_node import PageNode
-from .protobuf_diagram_generator import generate_proto_diagrams
-from .protodoc_extractor import ProtoDocExtractor
-from .rustdoc_extractor import RustDocExtractor
+from .profiler import Profiler
 from .utils import (
     convert_graphviz_to_rst,
     convert_mermaid_to_rst,
@@ -30,16 +38,43 @@ from .utils import (
     count_display_width,
     process_rst_directives,
 )
-from .yaml_loader import IncludeLoader
+from .yaml_loader import get_include_loader
+
+# Jinja2, the hub and the language extractors are imported lazily inside the
+# methods that need them, keeping CLI startup fast for configs (and dry runs)
+# that never touch them
+if TYPE_CHECKING:
+    from jinja2 import FileSystemBytecodeCache, Template
 
-# Support both direct execution and package import
-try:
-    from introligo.hub import DocumentationHub
-except ModuleNotFoundError:
     from .hub import DocumentationHub
 
 logger = logging.getLogger(__name__)
 
+# Palettes are static assets; parsed palettes are cached per content hash so
+# repeated runs in a resident process skip YAML loading entirely. Cached
+# entries are deep-copied on reuse to keep callers free to mutate their copy.
+_palette_cache: Dict[str, Dict[str, Any]] = {}
+
+
+@lru_cache(maxsize=None)
+def is_package_available(package_name: str) -> bool:
+    """Check if a Python package is available for import.
+
+    The probe actually imports the package, which can be slow, so results
+    are memoized for the lifetime of the process.
+
+    Args:
+        package_name: Importable package name (dashes are normalized).
+
+    Returns:
+        True if the package can be imported.
+    """
+    try:
+        __import__(package_name.replace("-", "_"))
+        return True
+    except ImportError:
+        return False
+
 
 @dataclass
 class PathConfig:
@@ -57,6 +92,8 @@ class GeneratorOptions:
 
     dry_run: bool = False
     strict: bool = False
+    incremental: bool = False
+    jobs: int = 1
 
 
 @dataclass
@@ -78,6 +115,9 @@ class IntroligoGenerator:
         template_file: Optional[Path] = None,
         dry_run: bool = False,
         strict: bool = False,
+        incremental: bool = False,
+        jobs: int = 1,
+        profiler: Optional[Profiler] = None,
     ):
         """Initialize the Introligo generator.
 
@@ -87,6 +127,14 @@ class IntroligoGenerator:
             template_file: Optional custom Jinja2 template file.
             dry_run: If True, only show what would be generated.
             strict: If True, fail on any generation error.
+            incremental: If True, skip re-rendering pages whose inputs
+                (config, included files, template) are unchanged since the
+                last run, reusing the previously generated RST.
+            jobs: Number of worker threads for page rendering. Values
+                greater than 1 render independent pages concurrently;
+                0 uses one worker per CPU.
+            profiler: Optional Profiler collecting per-phase and per-page
+                wall times for this run.
         """
         self.paths = PathConfig(
             config_file=config_file,
@@ -94,7 +142,9 @@ class IntroligoGenerator:
             generated_dir=output_dir / "generated",
             template_file=template_file,
         )
-        self.options = GeneratorOptions(dry_run=dry_run, strict=strict)
+        self.options = GeneratorOptions(
+            dry_run=dry_run, strict=strict, incremental=incremental, jobs=jobs
+        )
         self.extensions = ExtensionFlags()
         self.config: Dict[str, Any] = {}
         self.page_tree: List[PageNode] = []
@@ -102,6 +152,40 @@ class IntroligoGenerator:
         self.sphinx_config: Dict[str, Any] = {}
         self.palette_data: Dict[str, Any] = {}
         self.hub: Optional[DocumentationHub] = None
+        self.anchor_registry = AnchorRegistry()
+        self._manifest: Dict[str, str] = {}
+        self._manifest_new: Dict[str, str] = {}
+        self._template_hash: str = ""
+        self._extraction_cache: Dict[str, Dict[str, str]] = {}
+        self._proto_parse_cache: Dict[str, Dict[str, Any]] = {}
+        self._diagram_cache: Optional[Dict[str, List[Dict[str, str]]]] = None
+        self._diagram_cache_dirty = False
+        self._javadoc_cache: Optional[Dict[str, str]] = None
+        self._javadoc_cache_size_loaded = 0
+        self._include_file_cache: Dict[Tuple[str, int, str], str] = {}
+        self.profiler = profiler
+
+    def _profile_phase(self, name: str) -> Any:
+        """Get a context manager timing a pipeline phase, if profiling.
+
+        Args:
+            name: Phase name reported to the profiler.
+
+        Returns:
+            The profiler's phase context, or a no-op context manager.
+        """
+        return self.profiler.phase(name) if self.profiler else nullcontext()
+
+    def _profile_helper(self, name: str) -> Any:
+        """Get a context manager timing a helper call, if profiling.
+
+        Args:
+            name: Helper name reported to the profiler.
+
+        Returns:
+            The profiler's helper context, or a no-op context manager.
+        """
+        return self.profiler.helper(name) if self.profiler else nullcontext()
 
     def load_config(self) -> None:
         """Load configuration with support for !include directives.
@@ -117,8 +201,9 @@ class IntroligoGenerator:
 
         try:
             with open(self.paths.config_file, encoding="utf-8") as f:
-                # Using custom IncludeLoader for YAML file inclusion feature
-                self.config = yaml.load(f, Loader=IncludeLoader)  # nosec B506
+                # Using custom include loaders for YAML file inclusion feature;
+                # the C-accelerated variant is picked when libyaml is available
+                self.config = yaml.load(f, Loader=get_include_loader())  # nosec B506
         except yaml.YAMLError as e:
             raise IntroligoError(f"Invalid YAML in {self.paths.config_file}: {e}") from e
 
@@ -143,6 +228,8 @@ class IntroligoGenerator:
 
         # Initialize documentation hub if configured
         if self.config.get("hub") or self.config.get("discovery"):
+            from .hub import DocumentationHub
+
             self.hub = DocumentationHub(self.paths.config_file, self.config)
             logger.info("🌐 Documentation Hub initialized")
 
@@ -166,7 +253,6 @@ class IntroligoGenerator:
         """
         modules = self.config["modules"]
         node_map: Dict[str, PageNode] = {}
-        seen_slugs = set()
 
         for page_id, page_config in modules.items():
             if not isinstance(page_config, dict):
@@ -174,9 +260,6 @@ class IntroligoGenerator:
                 continue
 
             node = PageNode(page_id, page_config)
-            if node.slug in seen_slugs:
-                logger.warning(f"Duplicate slug detected: {node.slug} (page {page_id})")
-            seen_slugs.add(node.slug)
             node_map[page_id] = node
 
         root_nodes = []
@@ -189,6 +272,25 @@ class IntroligoGenerator:
             else:
                 root_nodes.append(node)
 
+        # Precompute output paths once the hierarchy is known, so toctree and
+        # index rendering resolve paths with dictionary lookups instead of
+        # walking parent pointers per call
+        for node in node_map.values():
+            node.compute_paths(self.paths.generated_dir)
+
+        # Register every page in the anchor registry once the hierarchy is
+        # known, so slug lookups and link resolution during rendering are O(1)
+        self.anchor_registry = AnchorRegistry()
+        for node in node_map.values():
+            output_file = node.get_output_file(self.paths.generated_dir)
+            if not self.anchor_registry.register_page(node.page_id, node.slug, output_file):
+                first_id = self.anchor_registry.resolve_page(node.slug)
+                first_file = self.anchor_registry.get_output_file(first_id) if first_id else None
+                logger.warning(
+                    f"Duplicate slug detected: {node.slug} "
+                    f"(page {node.page_id} collides with {first_id} -> {first_file})"
+                )
+
         self.page_tree = root_nodes
         logger.info(f"Built page tree with {len(root_nodes)} root pages")
 
@@ -738,9 +840,37 @@ Related Tools
 {% endif %}
 """
 
+    def _get_template_bytecode_cache(self) -> Optional[FileSystemBytecodeCache]:
+        """Get a persistent bytecode cache for compiled templates.
+
+        Compiled templates are cached under the output directory so repeated
+        invocations and watch-mode rebuilds skip template compilation.
+
+        Returns:
+            FileSystemBytecodeCache instance, or None if the cache directory
+            cannot be created (e.g. dry runs or read-only output).
+        """
+        if self.options.dry_run:
+            return None
+
+        cache_dir = self.paths.output_dir / ".introligo_cache" / "jinja2"
+        try:
+            cache_dir.mkdir(parents=True, exist_ok=True)
+        except OSError as e:
+            logger.warning(f"Template bytecode cache unavailable: {e}")
+            return None
+
+        from jinja2 import FileSystemBytecodeCache
+
+        return FileSystemBytecodeCache(str(cache_dir))
+
     def load_template(self) -> Template:
         """Load template and add custom filters.
 
+        The compiled template is stored in a persistent bytecode cache keyed
+        by template content hash, so unchanged templates are not recompiled
+        on subsequent runs.
+
         Returns:
             Configured Jinja2 Template object with custom filters.
         """
@@ -751,12 +881,23 @@ Related Tools
             template_content = self.get_default_template()
             logger.info("Using enhanced default template")
 
+        # Remember the template hash so incremental mode can detect template changes
+        self._template_hash = hashlib.sha256(template_content.encode("utf-8")).hexdigest()
+
+        from jinja2 import Environment, FunctionLoader
+
         # Create environment with custom filter
         # Generating RST documentation, not HTML, XSS not applicable
-        env = Environment()  # nosec B701
+        env = Environment(  # nosec B701
+            loader=FunctionLoader(lambda name: template_content),
+            bytecode_cache=self._get_template_bytecode_cache(),
+            auto_reload=False,
+        )
         env.filters["display_width"] = count_display_width
 
-        return env.from_string(template_content)
+        # The content hash in the template name keys the bytecode cache, so a
+        # changed template never collides with a stale cache entry.
+        return env.get_template(f"introligo-{self._template_hash}")
 
     def process_usage_examples(self, examples: Any) -> List[Dict[str, Any]]:
         """Process usage examples to ensure they're in the right format.
@@ -811,6 +952,35 @@ Related Tools
 
         return processed
 
+    def _convert_file_cached(self, kind: str, path_obj: Path, convert: Any) -> str:
+        """Read and convert an included file, caching the converted RST.
+
+        The same CONTRIBUTING or architecture doc is often included on many
+        pages; the cache is keyed by (path, mtime, kind) so each physical
+        file is read and converted at most once per generation run.
+
+        Args:
+            kind: Conversion kind used in the cache key (e.g. "markdown").
+            path_obj: Resolved path to the file to include.
+            convert: Callable converting the raw file content to RST.
+
+        Returns:
+            The converted RST content.
+        """
+        try:
+            mtime_ns = path_obj.stat().st_mtime_ns
+        except OSError:
+            mtime_ns = -1
+        cache_key = (str(path_obj), mtime_ns, kind)
+        cached = self._include_file_cache.get(cache_key)
+        if cached is not None:
+            return cached
+
+        with self._profile_helper(f"include_{kind}"):
+            content: str = convert(path_obj.read_text(encoding="utf-8"))
+        self._include_file_cache[cache_key] = content
+        return content
+
     def include_markdown_file(self, markdown_path: str) -> str:
         """Include a markdown file and convert it to reStructuredText-compatible format.
 
@@ -832,9 +1002,15 @@ Related Tools
             raise IntroligoError(f"Markdown file not found: {md_path_obj}")
 
         try:
-            content = md_path_obj.read_text(encoding="utf-8")
-            # Convert basic markdown to RST
-            content = convert_markdown_to_rst(content)
+            # Convert basic markdown to RST (cached per file per run);
+            # headings and link targets go through the anchor registry
+            content = self._convert_file_cached(
+                "markdown",
+                md_path_obj,
+                lambda text: convert_markdown_to_rst(
+                    text, registry=self.anchor_registry, source=str(md_path_obj)
+                ),
+            )
             logger.info(f"  Included markdown: {md_path_obj}")
             return content
         except Exception as e:
@@ -861,9 +1037,10 @@ Related Tools
             raise IntroligoError(f"LaTeX file not found: {latex_path_obj}")
 
         try:
-            content = latex_path_obj.read_text(encoding="utf-8")
-            # Wrap LaTeX content in RST math directive
-            rst_content = self._convert_latex_to_rst(content)
+            # Wrap LaTeX content in RST math directive (cached per file per run)
+            rst_content = self._convert_file_cached(
+                "latex", latex_path_obj, self._convert_latex_to_rst
+            )
             logger.info(f"  📐 Included LaTeX: {latex_path_obj}")
             return rst_content
         except Exception as e:
@@ -890,7 +1067,7 @@ Related Tools
             raise IntroligoError(f"RST file not found: {rst_path_obj}")
 
         try:
-            content = rst_path_obj.read_text(encoding="utf-8")
+            content = self._convert_file_cached("rst", rst_path_obj, lambda text: text)
             logger.info(f"  Included RST: {rst_path_obj}")
             return content
         except Exception as e:
@@ -916,12 +1093,15 @@ Related Tools
         if not txt_path_obj.exists():
             raise IntroligoError(f"Text file not found: {txt_path_obj}")
 
-        try:
-            content = txt_path_obj.read_text(encoding="utf-8")
-            # Wrap in literal block
+        def to_literal_block(content: str) -> str:
             rst_content = "::\n\n"
             for line in content.split("\n"):
                 rst_content += "   " + line + "\n"
+            return rst_content
+
+        try:
+            # Wrap in literal block (cached per file per run)
+            rst_content = self._convert_file_cached("txt", txt_path_obj, to_literal_block)
             logger.info(f"  Included text: {txt_path_obj}")
             return rst_content
         except Exception as e:
@@ -1139,11 +1319,26 @@ Related Tools
             parsed_files = self._parse_proto_files(proto_extractor, proto_file_paths, proto_package)
 
             if parsed_files:
+                # Reuse diagrams from the previous run if the schema and the
+                # diagram configuration are both unchanged
+                fingerprint = self._diagram_fingerprint(parsed_files, protobuf_diagrams)
+                cached = self._lookup_cached_diagrams(fingerprint)
+                if cached is not None:
+                    logger.info("  📊 Reusing cached protobuf diagram(s) (schema unchanged)")
+                    self._include_generated_diagrams(cached, diagram_content)
+                    return
+
                 # Generate diagrams
+                from .protobuf_diagram_generator import generate_proto_diagrams
+
                 generated = generate_proto_diagrams(
                     parsed_files, protobuf_diagrams, self.paths.output_dir
                 )
 
+                self._load_diagram_cache()[fingerprint] = generated
+                self._diagram_cache_dirty = True
+                self._save_diagram_cache()
+
                 # Add generated diagrams to diagram_includes
                 self._include_generated_diagrams(generated, diagram_content)
         except Exception as e:
@@ -1284,6 +1479,283 @@ Related Tools
 
         return "\n".join(result)
 
+    def _extract_godoc(self, config: Dict[str, Any]) -> str:
+        """Extract Go documentation for a page configuration.
+
+        Args:
+            config: Page configuration dictionary.
+
+        Returns:
+            Extracted Go documentation as RST, or empty string.
+        """
+        godoc_package = config.get("godoc_package", "")
+        godoc_packages = config.get("godoc_packages", [])
+        if godoc_package and not godoc_packages:
+            godoc_packages = [godoc_package]
+
+        if config.get("language") != "go" or not (godoc_package or godoc_packages):
+            return ""
+
+        manual_godoc = config.get("godoc_manual_content")
+        if manual_godoc:
+            # Use manually provided documentation
+            logger.info("Using manually provided Go documentation")
+            return str(manual_godoc)
+
+        # Determine package path (relative to config file)
+        godoc_path = config.get("godoc_path")
+        if godoc_path:
+            godoc_path_obj = Path(godoc_path)
+            if not godoc_path_obj.is_absolute():
+                godoc_path_obj = self.paths.config_file.parent / godoc_path
+        else:
+            # Try to use config file's parent directory
+            godoc_path_obj = self.paths.config_file.parent
+
+        from .godoc_extractor import GoDocExtractor
+
+        extractor = GoDocExtractor(package_path=godoc_path_obj)
+
+        if godoc_packages:
+            # Extract for multiple packages
+            results = extractor.extract_packages_parallel(godoc_packages)
+            content_parts = []
+            for pkg_name, success, content in results:
+                if success:
+                    content_parts.append(f"Package: ``{pkg_name}``\n")
+                    content_parts.append("~" * (len(pkg_name) + 11) + "\n\n")
+                content_parts.append(content)
+                content_parts.append("\n\n")
+            return "".join(content_parts)
+
+        # Extract for single package
+        success, content = extractor.extract_and_convert(godoc_package)
+        return content
+
+    def _extract_javadoc(self, config: Dict[str, Any]) -> str:
+        """Extract Java documentation for a page configuration.
+
+        Args:
+            config: Page configuration dictionary.
+
+        Returns:
+            Extracted Java documentation as RST, or empty string.
+        """
+        if config.get("language") != "java":
+            return ""
+
+        manual_javadoc = config.get("java_manual_content")
+        if manual_javadoc:
+            # Use manually provided documentation
+            logger.info("Using manually provided Java documentation")
+            return str(manual_javadoc)
+
+        java_source_files = config.get("java_source_files", [])
+        java_package = config.get("java_package", "")
+        java_packages = config.get("java_packages", [])
+
+        # Determine source path (relative to config file)
+        java_source_path = config.get("java_source_path")
+        if java_source_path:
+            java_source_path_obj = Path(java_source_path)
+            if not java_source_path_obj.is_absolute():
+                java_source_path_obj = self.paths.config_file.parent / java_source_path
+        else:
+            # Try to use config file's parent directory
+            java_source_path_obj = self.paths.config_file.parent
+
+        from .javadoc_extractor import JavaDocExtractor
+
+        java_extractor = JavaDocExtractor(source_path=java_source_path_obj)
+        java_extractor.result_cache = self._load_javadoc_cache()
+
+        if java_packages:
+            # Extract for multiple packages
+            content_parts = []
+            for pkg_name in java_packages:
+                # Convert package name to directory path (com.example -> com/example)
+                pkg_path = java_source_path_obj / pkg_name.replace(".", "/")
+                success, content = java_extractor.extract_package(pkg_path, pkg_name)
+                if success:
+                    content_parts.append(content)
+                    content_parts.append("\n\n")
+            return "".join(content_parts)
+
+        if java_package:
+            # Extract for single package
+            pkg_path = java_source_path_obj / java_package.replace(".", "/")
+            success, content = java_extractor.extract_package(pkg_path, java_package)
+            return content
+
+        if java_source_files:
+            # Extract from specific source files
+            java_file_paths = []
+            for file_path in java_source_files:
+                file_path_obj = Path(file_path)
+                if not file_path_obj.is_absolute():
+                    file_path_obj = self.paths.config_file.parent / file_path
+                java_file_paths.append(file_path_obj)
+
+            results = java_extractor.extract_files_parallel(java_file_paths)
+            content_parts = []
+            for filename, success, content in results:
+                if success:
+                    content_parts.append(f"{filename}\n")
+                    content_parts.append("~" * len(filename) + "\n\n")
+                content_parts.append(content)
+                content_parts.append("\n\n")
+            return "".join(content_parts)
+
+        return ""
+
+    def _extract_rustdoc(self, config: Dict[str, Any]) -> str:
+        """Extract Rust documentation for a page configuration.
+
+        Args:
+            config: Page configuration dictionary.
+
+        Returns:
+            Extracted Rust documentation as RST, or empty string.
+        """
+        if config.get("language") != "rust":
+            return ""
+
+        manual_rustdoc = config.get("rustdoc_manual_content")
+        if manual_rustdoc:
+            # Use manually provided documentation
+            logger.info("Using manually provided Rust documentation")
+            return str(manual_rustdoc)
+
+        # Determine crate path (relative to config file)
+        rustdoc_path = config.get("rustdoc_path", "")
+        if rustdoc_path:
+            rustdoc_path_obj = Path(rustdoc_path)
+            if not rustdoc_path_obj.is_absolute():
+                rustdoc_path_obj = self.paths.config_file.parent / rustdoc_path
+        else:
+            # Try to use config file's parent directory
+            rustdoc_path_obj = self.paths.config_file.parent
+
+        from .rustdoc_extractor import RustDocExtractor
+
+        rust_extractor = RustDocExtractor(crate_path=rustdoc_path_obj)
+        success, content = rust_extractor.extract_and_convert(config.get("rustdoc_crate", ""))
+        return content
+
+    def _extract_protodoc(self, config: Dict[str, Any]) -> str:
+        """Extract Protobuf documentation for a page configuration.
+
+        Args:
+            config: Page configuration dictionary.
+
+        Returns:
+            Extracted Protobuf documentation as RST, or empty string.
+        """
+        if config.get("language") != "protobuf":
+            return ""
+
+        manual_protodoc = config.get("protodoc_manual_content")
+        if manual_protodoc:
+            # Use manually provided documentation
+            logger.info("Using manually provided Protobuf documentation")
+            return str(manual_protodoc)
+
+        # Determine proto path (relative to config file)
+        proto_path = config.get("proto_path", "")
+        if proto_path:
+            proto_path_obj = Path(proto_path)
+            if not proto_path_obj.is_absolute():
+                proto_path_obj = self.paths.config_file.parent / proto_path
+        else:
+            # Try to use config file's parent directory
+            proto_path_obj = self.paths.config_file.parent
+
+        proto_files = config.get("proto_files", [])
+        proto_package = config.get("proto_package", "")
+
+        from .protodoc_extractor import ProtoDocExtractor
+
+        proto_extractor = ProtoDocExtractor(proto_path=proto_path_obj)
+        proto_extractor.parse_cache = self._proto_parse_cache
+        success, content = proto_extractor.extract_and_convert(
+            proto_files if proto_files else None, proto_package if proto_package else None
+        )
+        return content
+
+    def _extract_language_content(self, node: PageNode) -> Dict[str, str]:
+        """Run all language extractors that apply to a node.
+
+        Args:
+            node: PageNode to extract documentation for.
+
+        Returns:
+            Dictionary with 'godoc', 'javadoc', 'rustdoc' and 'protodoc'
+            extracted content (empty strings when not applicable).
+        """
+        config = node.config
+        extracted = {}
+        for kind, extract in (
+            ("godoc", self._extract_godoc),
+            ("javadoc", self._extract_javadoc),
+            ("rustdoc", self._extract_rustdoc),
+            ("protodoc", self._extract_protodoc),
+        ):
+            with self._profile_helper(f"extract_{kind}"):
+                extracted[kind] = extract(config)
+        return extracted
+
+    @staticmethod
+    def _needs_extraction(config: Dict[str, Any]) -> bool:
+        """Check whether a page configuration triggers a language extractor.
+
+        Args:
+            config: Page configuration dictionary.
+
+        Returns:
+            True if an external extractor would run for this page.
+        """
+        language = config.get("language")
+        if language == "go":
+            return bool(config.get("godoc_package") or config.get("godoc_packages"))
+        return language in ("java", "rust", "protobuf")
+
+    def prefetch_extracted_content(self, nodes: List[PageNode], jobs: int = 4) -> None:
+        """Run language extractors for all nodes concurrently before rendering.
+
+        Extractors shell out to external tools (gdoc, cargo, etc.) and spend
+        most of their time waiting on subprocesses, so running them in a small
+        thread pool overlaps that wait. Results are cached per page and reused
+        by generate_rst_content(). Failures are left uncached so the serial
+        render path reproduces them with proper error context.
+
+        In incremental mode, pages whose manifest fingerprint still matches
+        are skipped entirely - their cached output is served by _render_node()
+        without rendering, so extracting for them would pay the subprocess
+        cost only to throw the result away.
+
+        Args:
+            nodes: Flattened list of all PageNodes.
+            jobs: Maximum number of concurrent extraction jobs.
+        """
+        pending = [
+            node
+            for node in nodes
+            if self._needs_extraction(node.config) and not self._node_output_cached(node)
+        ]
+        if len(pending) < 2:
+            return
+
+        logger.info(f"🔄 Prefetching extractor output for {len(pending)} page(s)...")
+        with ThreadPoolExecutor(max_workers=min(jobs, len(pending))) as executor:
+            futures = {
+                executor.submit(self._extract_language_content, node): node for node in pending
+            }
+            for future, node in futures.items():
+                try:
+                    self._extraction_cache[node.page_id] = future.result()
+                except Exception as e:
+                    logger.warning(f"Extraction prefetch failed for {node.page_id}: {e}")
+
     def generate_rst_content(self, node: PageNode, template: Template) -> str:
         """Generate RST content with enhanced features support.
 
@@ -1410,189 +1882,49 @@ Related Tools
         if godoc_package and not godoc_packages:
             godoc_packages = [godoc_package]
 
-        # Extract Go documentation if Go language is specified
-        godoc_extracted_content = ""
-
-        # Check if manual documentation is provided
-        manual_godoc = config.get("godoc_manual_content")
-
-        if config.get("language") == "go" and (godoc_package or godoc_packages):
-            if manual_godoc:
-                # Use manually provided documentation
-                godoc_extracted_content = manual_godoc
-                logger.info("Using manually provided Go documentation")
-            else:
-                # Try automatic extraction
-                # Determine package path (relative to config file)
-                godoc_path = config.get("godoc_path")
-                if godoc_path:
-                    godoc_path_obj = Path(godoc_path)
-                    if not godoc_path_obj.is_absolute():
-                        godoc_path_obj = self.paths.config_file.parent / godoc_path
-                else:
-                    # Try to use config file's parent directory
-                    godoc_path_obj = self.paths.config_file.parent
-
-                extractor = GoDocExtractor(package_path=godoc_path_obj)
-
-                if godoc_packages:
-                    # Extract for multiple packages
-                    results = extractor.extract_multiple_packages(godoc_packages)
-                    content_parts = []
-                    for pkg_name, success, content in results:
-                        if success:
-                            content_parts.append(f"Package: ``{pkg_name}``\n")
-                            content_parts.append("~" * (len(pkg_name) + 11) + "\n\n")
-                        content_parts.append(content)
-                        content_parts.append("\n\n")
-                    godoc_extracted_content = "".join(content_parts)
-                elif godoc_package:
-                    # Extract for single package
-                    success, content = extractor.extract_and_convert(godoc_package)
-                    godoc_extracted_content = content
-
-        # Handle Java documentation extraction
+        # Java documentation fields (also passed to the template context)
         java_source_files = config.get("java_source_files", [])
         java_package = config.get("java_package", "")
         java_packages = config.get("java_packages", [])
         javadoc_path = config.get("javadoc_path", "")
 
-        # Extract Java documentation if Java language is specified
-        javadoc_extracted_content = ""
-
-        # Check if manual documentation is provided
-        manual_javadoc = config.get("java_manual_content")
-
-        if config.get("language") == "java":
-            if manual_javadoc:
-                # Use manually provided documentation
-                javadoc_extracted_content = manual_javadoc
-                logger.info("Using manually provided Java documentation")
-            else:
-                # Try automatic extraction
-                # Determine source path (relative to config file)
-                java_source_path = config.get("java_source_path")
-                if java_source_path:
-                    java_source_path_obj = Path(java_source_path)
-                    if not java_source_path_obj.is_absolute():
-                        java_source_path_obj = self.paths.config_file.parent / java_source_path
-                else:
-                    # Try to use config file's parent directory
-                    java_source_path_obj = self.paths.config_file.parent
-
-                java_extractor = JavaDocExtractor(source_path=java_source_path_obj)
-
-                if java_packages:
-                    # Extract for multiple packages
-                    content_parts = []
-                    for pkg_name in java_packages:
-                        # Convert package name to directory path (com.example -> com/example)
-                        pkg_path = java_source_path_obj / pkg_name.replace(".", "/")
-                        success, content = java_extractor.extract_package(pkg_path, pkg_name)
-                        if success:
-                            content_parts.append(content)
-                            content_parts.append("\n\n")
-                    javadoc_extracted_content = "".join(content_parts)
-                elif java_package:
-                    # Extract for single package
-                    pkg_path = java_source_path_obj / java_package.replace(".", "/")
-                    success, content = java_extractor.extract_package(pkg_path, java_package)
-                    javadoc_extracted_content = content
-                elif java_source_files:
-                    # Extract from specific source files
-                    java_file_paths = []
-                    for file_path in java_source_files:
-                        file_path_obj = Path(file_path)
-                        if not file_path_obj.is_absolute():
-                            file_path_obj = self.paths.config_file.parent / file_path
-                        java_file_paths.append(file_path_obj)
-
-                    results = java_extractor.extract_multiple_files(java_file_paths)
-                    content_parts = []
-                    for filename, success, content in results:
-                        if success:
-                            content_parts.append(f"{filename}\n")
-                            content_parts.append("~" * len(filename) + "\n\n")
-                        content_parts.append(content)
-                        content_parts.append("\n\n")
-                    javadoc_extracted_content = "".join(content_parts)
-
-        # Handle Rust documentation extraction
+        # Rust documentation fields
         rustdoc_crate = config.get("rustdoc_crate", "")
         rustdoc_path = config.get("rustdoc_path", "")
 
-        # Extract Rust documentation if Rust language is specified
-        rustdoc_extracted_content = ""
-
-        # Check if manual documentation is provided
-        manual_rustdoc = config.get("rustdoc_manual_content")
-
-        if config.get("language") == "rust":
-            if manual_rustdoc:
-                # Use manually provided documentation
-                rustdoc_extracted_content = manual_rustdoc
-                logger.info("Using manually provided Rust documentation")
-            else:
-                # Try automatic extraction
-                # Determine crate path (relative to config file)
-                if rustdoc_path:
-                    rustdoc_path_obj = Path(rustdoc_path)
-                    if not rustdoc_path_obj.is_absolute():
-                        rustdoc_path_obj = self.paths.config_file.parent / rustdoc_path
-                else:
-                    # Try to use config file's parent directory
-                    rustdoc_path_obj = self.paths.config_file.parent
-
-                rust_extractor = RustDocExtractor(crate_path=rustdoc_path_obj)
-                success, content = rust_extractor.extract_and_convert(rustdoc_crate)
-                rustdoc_extracted_content = content
-
-        # Handle Protobuf documentation extraction
+        # Protobuf documentation fields
         proto_files = config.get("proto_files", [])
         proto_package = config.get("proto_package", "")
         proto_path = config.get("proto_path", "")
-
-        # Extract Protobuf documentation if protobuf language is specified
-        protodoc_extracted_content = ""
         proto_extractor = None
 
-        # Check if manual documentation is provided
-        manual_protodoc = config.get("protodoc_manual_content")
-
-        if config.get("language") == "protobuf":
-            if manual_protodoc:
-                # Use manually provided documentation
-                protodoc_extracted_content = manual_protodoc
-                logger.info("Using manually provided Protobuf documentation")
-            else:
-                # Try automatic extraction
-                # Determine proto path (relative to config file)
-                if proto_path:
-                    proto_path_obj = Path(proto_path)
-                    if not proto_path_obj.is_absolute():
-                        proto_path_obj = self.paths.config_file.parent / proto_path
-                else:
-                    # Try to use config file's parent directory
-                    proto_path_obj = self.paths.config_file.parent
-
-                proto_extractor = ProtoDocExtractor(proto_path=proto_path_obj)
-                success, content = proto_extractor.extract_and_convert(
-                    proto_files if proto_files else None, proto_package if proto_package else None
-                )
-                protodoc_extracted_content = content
+        # Run (or reuse prefetched) external documentation extraction
+        extracted = self._extraction_cache.get(node.page_id)
+        if extracted is None:
+            extracted = self._extract_language_content(node)
+        godoc_extracted_content = extracted["godoc"]
+        javadoc_extracted_content = extracted["javadoc"]
+        rustdoc_extracted_content = extracted["rustdoc"]
+        protodoc_extracted_content = extracted["protodoc"]
 
         # Generate automatic diagrams from protobuf if configured
         # This can work independently of language setting
         protobuf_diagrams = config.get("protobuf_diagrams", [])
         if protobuf_diagrams:
+            from .protodoc_extractor import ProtoDocExtractor
+
             # Create proto_extractor if not already created (for diagram-only generation)
             if not proto_extractor and proto_path:
                 proto_path_obj = Path(proto_path)
                 if not proto_path_obj.is_absolute():
                     proto_path_obj = self.paths.config_file.parent / proto_path
                 proto_extractor = ProtoDocExtractor(proto_path=proto_path_obj)
+            elif not proto_extractor and config.get("language") == "protobuf":
+                # Fall back to the config file's directory, matching extraction
+                proto_extractor = ProtoDocExtractor(proto_path=self.paths.config_file.parent)
 
             if proto_extractor:
+                proto_extractor.parse_cache = self._proto_parse_cache
                 self._generate_protobuf_diagrams(
                     proto_extractor,
                     protobuf_diagrams,
@@ -1741,6 +2073,283 @@ Related Tools
 
         return content
 
+    def get_manifest_path(self) -> Path:
+        """Get the path of the incremental generation manifest.
+
+        Returns:
+            Path to the manifest file under the output directory.
+        """
+        return self.paths.output_dir / ".introligo_manifest.json"
+
+    def load_manifest(self) -> Dict[str, str]:
+        """Load the incremental generation manifest from a previous run.
+
+        Returns:
+            Dictionary mapping page ids to input fingerprints, or an empty
+            dictionary if no valid manifest exists.
+        """
+        manifest_path = self.get_manifest_path()
+        if not manifest_path.exists():
+            return {}
+
+        try:
+            data = json.loads(manifest_path.read_text(encoding="utf-8"))
+            if isinstance(data, dict):
+                return {str(k): str(v) for k, v in data.items()}
+        except (OSError, json.JSONDecodeError) as e:
+            logger.warning(f"Ignoring unreadable manifest {manifest_path}: {e}")
+        return {}
+
+    def save_manifest(self) -> None:
+        """Persist the incremental generation manifest for the next run."""
+        if self.options.dry_run or not self._manifest_new:
+            return
+
+        manifest_path = self.get_manifest_path()
+        try:
+            manifest_path.parent.mkdir(parents=True, exist_ok=True)
+            manifest_path.write_text(
+                json.dumps(self._manifest_new, indent=2, sort_keys=True), encoding="utf-8"
+            )
+            logger.info(f"Saved incremental manifest: {manifest_path}")
+        except OSError as e:
+            logger.warning(f"Failed to save manifest {manifest_path}: {e}")
+
+    def get_diagram_cache_path(self) -> Path:
+        """Get the path of the generated protobuf diagram cache.
+
+        Returns:
+            Path to the diagram cache file under the output directory.
+        """
+        return self.paths.output_dir / ".introligo_diagram_cache.json"
+
+    def _load_diagram_cache(self) -> Dict[str, List[Dict[str, str]]]:
+        """Load the protobuf diagram cache from a previous run.
+
+        Returns:
+            Dictionary mapping schema fingerprints to generated diagram
+            metadata, or an empty dictionary if no valid cache exists.
+        """
+        if self._diagram_cache is not None:
+            return self._diagram_cache
+
+        self._diagram_cache = {}
+        cache_path = self.get_diagram_cache_path()
+        if cache_path.exists():
+            try:
+                data = json.loads(cache_path.read_text(encoding="utf-8"))
+                if isinstance(data, dict):
+                    self._diagram_cache = {
+                        str(key): value for key, value in data.items() if isinstance(value, list)
+                    }
+            except (OSError, json.JSONDecodeError) as e:
+                logger.warning(f"Ignoring unreadable diagram cache {cache_path}: {e}")
+        return self._diagram_cache
+
+    def _save_diagram_cache(self) -> None:
+        """Persist the protobuf diagram cache for the next run."""
+        if self.options.dry_run or not self._diagram_cache_dirty or self._diagram_cache is None:
+            return
+
+        cache_path = self.get_diagram_cache_path()
+        try:
+            cache_path.parent.mkdir(parents=True, exist_ok=True)
+            cache_path.write_text(
+                json.dumps(self._diagram_cache, indent=2, sort_keys=True), encoding="utf-8"
+            )
+            self._diagram_cache_dirty = False
+        except OSError as e:
+            logger.warning(f"Failed to save diagram cache {cache_path}: {e}")
+
+    def get_javadoc_cache_path(self) -> Path:
+        """Get the path of the parsed Javadoc result cache.
+
+        Returns:
+            Path to the Javadoc cache file under the output directory.
+        """
+        return self.paths.output_dir / ".introligo_javadoc_cache.json"
+
+    def _load_javadoc_cache(self) -> Dict[str, str]:
+        """Load the Javadoc result cache from a previous run.
+
+        Returns:
+            Dictionary mapping Java source content hashes to converted RST,
+            or an empty dictionary if no valid cache exists.
+        """
+        if self._javadoc_cache is not None:
+            return self._javadoc_cache
+
+        self._javadoc_cache = {}
+        cache_path = self.get_javadoc_cache_path()
+        if cache_path.exists():
+            try:
+                data = json.loads(cache_path.read_text(encoding="utf-8"))
+                if isinstance(data, dict):
+                    self._javadoc_cache = {str(k): str(v) for k, v in data.items()}
+            except (OSError, json.JSONDecodeError) as e:
+                logger.warning(f"Ignoring unreadable Javadoc cache {cache_path}: {e}")
+        self._javadoc_cache_size_loaded = len(self._javadoc_cache)
+        return self._javadoc_cache
+
+    def _save_javadoc_cache(self) -> None:
+        """Persist the Javadoc result cache when new entries were added."""
+        if (
+            self.options.dry_run
+            or self._javadoc_cache is None
+            or len(self._javadoc_cache) == self._javadoc_cache_size_loaded
+        ):
+            return
+
+        cache_path = self.get_javadoc_cache_path()
+        try:
+            cache_path.parent.mkdir(parents=True, exist_ok=True)
+            cache_path.write_text(
+                json.dumps(self._javadoc_cache, indent=2, sort_keys=True), encoding="utf-8"
+            )
+            self._javadoc_cache_size_loaded = len(self._javadoc_cache)
+        except OSError as e:
+            logger.warning(f"Failed to save Javadoc cache {cache_path}: {e}")
+
+    @staticmethod
+    def _diagram_fingerprint(parsed_files: List[Dict], diagram_configs: List) -> str:
+        """Compute a fingerprint for a diagram generation request.
+
+        Args:
+            parsed_files: Parsed proto structures feeding the diagrams.
+            diagram_configs: Diagram configuration list from the page config.
+
+        Returns:
+            Hex digest covering both the schema content and the diagram
+            configuration, so either changing invalidates the cache.
+        """
+        payload = json.dumps([parsed_files, diagram_configs], sort_keys=True, default=str)
+        return hashlib.sha256(payload.encode("utf-8")).hexdigest()
+
+    def _lookup_cached_diagrams(self, fingerprint: str) -> Optional[List[Dict[str, str]]]:
+        """Look up previously generated diagrams for an unchanged schema.
+
+        Args:
+            fingerprint: Fingerprint from _diagram_fingerprint().
+
+        Returns:
+            Cached diagram metadata if every diagram file still exists on
+            disk, None otherwise.
+        """
+        entries = self._load_diagram_cache().get(fingerprint)
+        if not entries:
+            return None
+
+        for entry in entries:
+            diagram_path = Path(entry.get("path", ""))
+            if not diagram_path.is_absolute():
+                diagram_path = self.paths.output_dir.parent / diagram_path
+            if not diagram_path.exists():
+                return None
+        return entries
+
+    def _collect_node_input_files(self, node: PageNode) -> List[Path]:
+        """Collect all files pulled into a page via include directives.
+
+        Args:
+            node: PageNode to inspect.
+
+        Returns:
+            List of resolved file paths referenced by the page config.
+        """
+        include_keys = [
+            "markdown_includes",
+            "latex_includes",
+            "rst_includes",
+            "file_includes",
+            "diagram_includes",
+        ]
+
+        paths: List[Path] = []
+        for key in include_keys:
+            entries = node.config.get(key, [])
+            if isinstance(entries, (str, dict)):
+                entries = [entries]
+            for entry in entries:
+                if isinstance(entry, dict):
+                    entry = entry.get("path", "")
+                if not entry:
+                    continue
+                path_obj = Path(entry)
+                if not path_obj.is_absolute():
+                    path_obj = self.paths.config_file.parent / entry
+                paths.append(path_obj)
+        return paths
+
+    def compute_node_fingerprint(self, node: PageNode) -> str:
+        """Compute a content fingerprint for all inputs of a page.
+
+        The fingerprint covers the page configuration, the template, every
+        file pulled in via include directives, and the child pages listed in
+        the toctree, so any change to these invalidates the cached output.
+
+        Args:
+            node: PageNode to fingerprint.
+
+        Returns:
+            Hex digest uniquely identifying the page's inputs.
+        """
+        hasher = hashlib.sha256()
+        hasher.update(self._template_hash.encode("utf-8"))
+        hasher.update(yaml.safe_dump(node.config, sort_keys=True).encode("utf-8"))
+
+        # Children affect the generated toctree
+        for child in node.children:
+            hasher.update(f"{child.page_id}:{child.title}:{child.slug}".encode())
+
+        for input_file in self._collect_node_input_files(node):
+            hasher.update(str(input_file).encode("utf-8"))
+            try:
+                hasher.update(input_file.read_bytes())
+            except OSError:
+                hasher.update(b"<missing>")
+
+        return hasher.hexdigest()
+
+    def _node_output_cached(self, node: PageNode) -> bool:
+        """Check whether incremental mode will reuse a page's cached output.
+
+        Args:
+            node: PageNode to check.
+
+        Returns:
+            True if the manifest fingerprint matches and the output file
+            exists, meaning _render_node() will not re-render the page.
+        """
+        if not self.options.incremental or not self._manifest:
+            return False
+        if self._manifest.get(node.page_id) != self.compute_node_fingerprint(node):
+            return False
+        return node.get_output_file(self.paths.generated_dir).exists()
+
+    def _render_node(self, node: PageNode, template: Template, output_file: Path) -> str:
+        """Render a single page, reusing cached output in incremental mode.
+
+        Args:
+            node: PageNode to render.
+            template: Jinja2 template for rendering.
+            output_file: Output path of the page's RST file.
+
+        Returns:
+            Generated (or reused) RST content.
+        """
+        page_timer = self.profiler.page(node.page_id) if self.profiler else nullcontext()
+        with page_timer:
+            if self.options.incremental:
+                fingerprint = self.compute_node_fingerprint(node)
+                self._manifest_new[node.page_id] = fingerprint
+                if self._manifest.get(node.page_id) == fingerprint and output_file.exists():
+                    logger.info(f"  Unchanged (cached): {node.title} -> {output_file}")
+                    return output_file.read_text(encoding="utf-8")
+
+            content = self.generate_rst_content(node, template)
+            logger.info(f"  Generated: {node.title} -> {output_file}")
+            return content
+
     def generate_all_nodes(
         self,
         nodes: List[PageNode],
@@ -1760,13 +2369,16 @@ Related Tools
         Raises:
             IntroligoError: If strict mode is enabled and generation fails.
         """
+        jobs = self.options.jobs if self.options.jobs > 0 else (os.cpu_count() or 1)
+        if jobs > 1:
+            return self._generate_nodes_parallel(nodes, template, strict, jobs)
+
         generated_files = {}
         for node in nodes:
             try:
-                content = self.generate_rst_content(node, template)
                 output_file = node.get_output_file(self.paths.generated_dir)
+                content = self._render_node(node, template, output_file)
                 generated_files[str(output_file)] = (content, output_file)
-                logger.info(f"  Generated: {node.title} -> {output_file}")
 
                 if node.children:
                     child_files = self.generate_all_nodes(node.children, template, strict)
@@ -1780,6 +2392,69 @@ Related Tools
                 continue
         return generated_files
 
+    def _collect_nodes(self, nodes: List[PageNode]) -> List[PageNode]:
+        """Flatten a page subtree into a depth-first list of nodes.
+
+        Args:
+            nodes: List of root PageNode objects.
+
+        Returns:
+            All nodes in the subtrees, in depth-first order.
+        """
+        collected = []
+        for node in nodes:
+            collected.append(node)
+            if node.children:
+                collected.extend(self._collect_nodes(node.children))
+        return collected
+
+    def _generate_nodes_parallel(
+        self,
+        nodes: List[PageNode],
+        template: Template,
+        strict: bool,
+        jobs: int,
+    ) -> Dict[str, Tuple[str, Path]]:
+        """Render all pages concurrently with a worker pool.
+
+        Pages are independent once the tree is built, so rendering is
+        distributed across worker threads and the results are merged in
+        depth-first order to match serial generation.
+
+        Args:
+            nodes: List of root PageNode objects to generate.
+            template: Jinja2 template for rendering.
+            strict: If True, raise exception on generation errors.
+            jobs: Number of worker threads.
+
+        Returns:
+            Dictionary mapping file paths to tuples of (content, Path).
+
+        Raises:
+            IntroligoError: If strict mode is enabled and generation fails.
+        """
+        all_nodes = self._collect_nodes(nodes)
+        logger.info(f"Rendering {len(all_nodes)} page(s) with {jobs} worker(s)")
+
+        def render(node: PageNode) -> Tuple[PageNode, str, Path]:
+            output_file = node.get_output_file(self.paths.generated_dir)
+            return node, self._render_node(node, template, output_file), output_file
+
+        generated_files: Dict[str, Tuple[str, Path]] = {}
+        with ThreadPoolExecutor(max_workers=jobs) as executor:
+            futures = [(node, executor.submit(render, node)) for node in all_nodes]
+            for node, future in futures:
+                try:
+                    _, content, output_file = future.result()
+                    generated_files[str(output_file)] = (content, output_file)
+                except Exception as e:
+                    if strict:
+                        raise IntroligoError(
+                            f"Strict mode: failed to generate {node.page_id}: {e}"
+                        ) from e
+                    logger.error(f"Failed to generate {node.page_id}: {e}")
+        return generated_files
+
     def generate_all(self) -> Dict[str, Tuple[str, Path]]:
         """Main generation method.
 
@@ -1788,25 +2463,201 @@ Related Tools
         Returns:
             Dictionary mapping file paths to tuples of (content, Path).
         """
-        self.load_config()
-        self.load_sphinx_config()
-        self.build_page_tree()
-        template = self.load_template()
+        with self._profile_phase("load_config"):
+            self.load_config()
+            self.load_sphinx_config()
+        with self._profile_phase("build_page_tree"):
+            self.build_page_tree()
+        with self._profile_phase("load_template"):
+            template = self.load_template()
+
+        if self.options.incremental:
+            self._manifest = self.load_manifest()
+            if self._manifest:
+                logger.info(f"Loaded incremental manifest ({len(self._manifest)} page(s))")
+
+        with self._profile_phase("prefetch_extraction"):
+            self.prefetch_extracted_content(self._collect_nodes(self.page_tree))
 
         logger.info("Generating RST files for page tree...")
-        generated_files = self.generate_all_nodes(self.page_tree, template, self.options.strict)
+        with self._profile_phase("render"):
+            generated_files = self.generate_all_nodes(
+                self.page_tree, template, self.options.strict
+            )
 
         if self.config.get("generate_index", True):
-            index_content = self.generate_index(self.page_tree)
+            with self._profile_phase("generate_index"):
+                index_content = self.generate_index(self.page_tree)
             index_path = self.paths.output_dir / "index.rst"
             generated_files[str(index_path)] = (index_content, index_path)
             logger.info("  📋 Generated: index.rst")
 
+        if self.options.incremental:
+            self.save_manifest()
+        self._save_javadoc_cache()
+
         return generated_files
 
+    def _stream_rendered_nodes(
+        self,
+        nodes: List[PageNode],
+        template: Template,
+        strict: bool,
+        jobs: int,
+    ) -> Iterator[Tuple[str, Path]]:
+        """Yield (content, output_file) pairs as pages finish rendering.
+
+        With multiple workers, at most 2 * jobs renders are in flight at a
+        time, so peak memory stays bounded by the window size rather than
+        the whole site while the writer consumes completed pages.
+
+        Args:
+            nodes: List of root PageNode objects to generate.
+            template: Jinja2 template for rendering.
+            strict: If True, raise exception on generation errors.
+            jobs: Number of worker threads.
+
+        Yields:
+            Tuples of (content, output_file) in depth-first page order.
+
+        Raises:
+            IntroligoError: If strict mode is enabled and generation fails.
+        """
+        all_nodes = self._collect_nodes(nodes)
+
+        def render(node: PageNode) -> Tuple[str, Path]:
+            output_file = node.get_output_file(self.paths.generated_dir)
+            return self._render_node(node, template, output_file), output_file
+
+        if jobs <= 1:
+            for node in all_nodes:
+                try:
+                    yield render(node)
+                except Exception as e:
+                    if strict:
+                        raise IntroligoError(
+                            f"Strict mode: failed to generate {node.page_id}: {e}"
+                        ) from e
+                    logger.error(f"Failed to generate {node.page_id}: {e}")
+            return
+
+        logger.info(f"Rendering {len(all_nodes)} page(s) with {jobs} worker(s)")
+        node_iter = iter(all_nodes)
+        with ThreadPoolExecutor(max_workers=jobs) as executor:
+            pending = deque(
+                (node, executor.submit(render, node)) for node in islice(node_iter, jobs * 2)
+            )
+            while pending:
+                node, future = pending.popleft()
+                try:
+                    yield future.result()
+                except Exception as e:
+                    if strict:
+                        raise IntroligoError(
+                            f"Strict mode: failed to generate {node.page_id}: {e}"
+                        ) from e
+                    logger.error(f"Failed to generate {node.page_id}: {e}")
+                for next_node in islice(node_iter, 1):
+                    pending.append((next_node, executor.submit(render, next_node)))
+
+    def generate_and_write(self) -> int:
+        """Generate and write all pages as a streaming pipeline.
+
+        Behaves like generate_all() followed by write_files(), but each
+        rendered page is written (or listed, in dry-run mode) as soon as
+        it completes and its content is released immediately afterwards,
+        so peak memory is bounded by the in-flight render window instead
+        of the sum of all RST content.
+
+        Returns:
+            Number of RST files generated.
+        """
+        with self._profile_phase("load_config"):
+            self.load_config()
+            self.load_sphinx_config()
+        with self._profile_phase("build_page_tree"):
+            self.build_page_tree()
+        with self._profile_phase("load_template"):
+            template = self.load_template()
+
+        if self.options.incremental:
+            self._manifest = self.load_manifest()
+            if self._manifest:
+                logger.info(f"Loaded incremental manifest ({len(self._manifest)} page(s))")
+
+        with self._profile_phase("prefetch_extraction"):
+            self.prefetch_extracted_content(self._collect_nodes(self.page_tree))
+
+        logger.info("Generating RST files for page tree...")
+        if self.options.dry_run:
+            logger.info("DRY RUN - Would generate:")
+
+        jobs = self.options.jobs if self.options.jobs > 0 else (os.cpu_count() or 1)
+        file_count = 0
+        written = 0
+        with self._profile_phase("render_and_write"):
+            for content, output_file in self._stream_rendered_nodes(
+                self.page_tree, template, self.options.strict, jobs
+            ):
+                if self._write_single_file(content, output_file):
+                    written += 1
+                file_count += 1
+
+        if self.config.get("generate_index", True):
+            with self._profile_phase("generate_index"):
+                index_content = self.generate_index(self.page_tree)
+            index_path = self.paths.output_dir / "index.rst"
+            logger.info("  📋 Generated: index.rst")
+            if self._write_single_file(index_content, index_path):
+                written += 1
+            file_count += 1
+
+        if not self.options.dry_run:
+            logger.info(f"✅ Wrote {written} file(s), skipped {file_count - written} unchanged")
+
+        if self.options.incremental:
+            self.save_manifest()
+        self._save_javadoc_cache()
+
+        return file_count
+
+    def _write_single_file(self, content: str, full_path: Path) -> bool:
+        """Write one generated file to disk, honoring dry-run mode.
+
+        The write is skipped when the file already holds identical content,
+        leaving its mtime untouched so downstream Sphinx builds only re-read
+        pages that actually changed.
+
+        Args:
+            content: Rendered RST content.
+            full_path: Destination path for the file.
+
+        Returns:
+            True if the file was written, False if it was skipped.
+        """
+        if self.options.dry_run:
+            logger.info(f"  {full_path}")
+            return False
+
+        if full_path.exists():
+            try:
+                if full_path.read_text(encoding="utf-8") == content:
+                    logger.debug(f"  Unchanged: {full_path}")
+                    return False
+            except OSError:
+                pass
+
+        full_path.parent.mkdir(parents=True, exist_ok=True)
+        full_path.write_text(content, encoding="utf-8")
+        logger.info(f"✅ Wrote: {full_path}")
+        return True
+
     def write_files(self, generated_files: Dict[str, Tuple[str, Path]]) -> None:
         """Write all generated files to disk.
 
+        Files whose on-disk content already matches are left untouched so
+        their mtimes stay stable for incremental Sphinx builds.
+
         Args:
             generated_files: Dictionary mapping file paths to (content, Path) tuples.
         """
@@ -1816,10 +2667,15 @@ Related Tools
                 logger.info(f"  {full_path}")
             return
 
-        for content, full_path in generated_files.values():
-            full_path.parent.mkdir(parents=True, exist_ok=True)
-            full_path.write_text(content, encoding="utf-8")
-            logger.info(f"✅ Wrote: {full_path}")
+        written = 0
+        skipped = 0
+        with self._profile_phase("write_files"):
+            for content, full_path in generated_files.values():
+                if self._write_single_file(content, full_path):
+                    written += 1
+                else:
+                    skipped += 1
+        logger.info(f"✅ Wrote {written} file(s), skipped {skipped} unchanged")
 
     def generate_breathe_config(self) -> Optional[str]:
         """Generate Breathe configuration snippet for Sphinx conf.py.
@@ -1894,11 +2750,26 @@ breathe_default_project = "{project_name}"
                         f"Tried: {palette_path}, {package_palette}, {config_relative}"
                     )
 
+        # Serve previously parsed palettes by content hash, covering both the
+        # static built-in palettes and user palettes edited between runs
+        digest = ""
+        try:
+            digest = hashlib.sha256(palette_path.read_bytes()).hexdigest()
+        except OSError:
+            pass
+        cached = _palette_cache.get(digest)
+        if cached is not None:
+            logger.info(f"✅ Loaded palette (cached): {cached.get('name', palette_name)}")
+            return deepcopy(cached)
+
         try:
             with open(palette_path, encoding="utf-8") as f:
-                # Using custom IncludeLoader for YAML file inclusion feature
-                palette_data: Dict[str, Any] = yaml.load(f, Loader=IncludeLoader)  # nosec B506
+                # Using custom include loaders for YAML file inclusion feature
+                loader_cls = get_include_loader()
+                palette_data: Dict[str, Any] = yaml.load(f, Loader=loader_cls)  # nosec B506
                 logger.info(f"✅ Loaded palette: {palette_data.get('name', palette_name)}")
+                if digest and isinstance(palette_data, dict):
+                    _palette_cache[digest] = deepcopy(palette_data)
                 return palette_data
         except Exception as e:
             raise IntroligoError(f"Error loading palette {palette_path}: {e}") from e
@@ -2052,11 +2923,85 @@ breathe_default_project = "{project_name}"
 
         return languages
 
+    def get_autoconfig_cache_path(self) -> Path:
+        """Get the path of the extension auto-configuration cache file.
+
+        Returns:
+            Path to the autoconfig cache in the output directory.
+        """
+        return self.paths.output_dir / ".introligo_autoconfig_cache.json"
+
+    def _autoconfig_cache_key(self) -> str:
+        """Compute the cache key for the extension auto-configuration.
+
+        The key covers the module configurations (which drive language
+        detection), the explicitly configured extensions, and the Python
+        environment (which drives package availability probes).
+
+        Returns:
+            Hex digest identifying the current autoconfig inputs.
+        """
+        payload = json.dumps(
+            {
+                "modules": self.config.get("modules", {}),
+                "extensions": self.sphinx_config.get("extensions", []),
+                "env": [sys.prefix, sys.version],
+            },
+            sort_keys=True,
+            default=str,
+        )
+        return hashlib.sha256(payload.encode("utf-8")).hexdigest()
+
+    def _load_autoconfig_cache(self) -> Dict[str, Any]:
+        """Load the persisted extension auto-configuration, if any.
+
+        Returns:
+            Cached autoconfig data, or an empty dict.
+        """
+        cache_path = self.get_autoconfig_cache_path()
+        if cache_path.exists():
+            try:
+                data = json.loads(cache_path.read_text(encoding="utf-8"))
+                if isinstance(data, dict):
+                    return data
+            except (json.JSONDecodeError, OSError) as e:
+                logger.warning(f"Failed to load autoconfig cache, re-detecting: {e}")
+        return {}
+
+    def _save_autoconfig_cache(self, data: Dict[str, Any]) -> None:
+        """Persist the extension auto-configuration result.
+
+        Args:
+            data: Autoconfig data including the cache key.
+        """
+        if self.options.dry_run:
+            return
+        cache_path = self.get_autoconfig_cache_path()
+        try:
+            cache_path.parent.mkdir(parents=True, exist_ok=True)
+            cache_path.write_text(json.dumps(data, indent=2, sort_keys=True), encoding="utf-8")
+        except OSError as e:
+            logger.warning(f"Failed to save autoconfig cache: {e}")
+
     def auto_configure_extensions(self) -> None:
-        """Automatically configure Sphinx extensions based on detected project types."""
+        """Automatically configure Sphinx extensions based on detected project types.
+
+        The detection result is cached keyed by module configuration and
+        Python environment, so repeated runs on an unchanged config skip
+        both the module scan and the package availability probes.
+        """
         if "sphinx" not in self.config:
             return
 
+        cache_key = self._autoconfig_cache_key()
+        cached = self._load_autoconfig_cache()
+        if cached.get("key") == cache_key:
+            self.sphinx_config["extensions"] = list(cached.get("extensions", []))
+            self.extensions.has_plantuml_extension = bool(cached.get("has_plantuml"))
+            self.extensions.has_mermaid_extension = bool(cached.get("has_mermaid"))
+            logger.info("Reusing cached extension auto-configuration (config unchanged)")
+            return
+
         # Get existing extensions or initialize empty list
         extensions = self.sphinx_config.get("extensions", [])
 
@@ -2169,15 +3114,6 @@ breathe_default_project = "{project_name}"
                 has_plantuml_global = has_plantuml_global or p
                 has_graphviz_global = has_graphviz_global or g
 
-        # Helper function to check if a package is available
-        def is_package_available(package_name: str) -> bool:
-            """Check if a Python package is available for import."""
-            try:
-                __import__(package_name.replace("-", "_"))
-                return True
-            except ImportError:
-                return False
-
         # Add diagram extensions as needed (only if packages are available)
         if has_graphviz_global and "sphinx.ext.graphviz" not in extensions:
             # sphinx.ext.graphviz is built-in to Sphinx, always available
@@ -2212,6 +3148,14 @@ breathe_default_project = "{project_name}"
 
         # Update the sphinx config with auto-detected extensions
         self.sphinx_config["extensions"] = extensions
+        self._save_autoconfig_cache(
+            {
+                "key": cache_key,
+                "extensions": extensions,
+                "has_plantuml": self.extensions.has_plantuml_extension,
+                "has_mermaid": self.extensions.has_mermaid_extension,
+            }
+        )
 
     def load_sphinx_config(self) -> None:
         """Load Sphinx configuration from the config file."""
@@ -2252,6 +3196,9 @@ breathe_default_project = "{project_name}"
             return None
 
         template_content = template_path.read_text(encoding="utf-8")
+
+        from jinja2 import Environment
+
         # Generating Python config file, not HTML, XSS not applicable
         env = Environment()  # nosec B701
         template = env.from_string(template_content)
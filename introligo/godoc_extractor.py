@@ -10,8 +10,9 @@ Copyright (c) 2025 WT Tech Jakub Brzezowski
 import logging
 import re
 import subprocess
+from concurrent.futures import ThreadPoolExecutor
 from pathlib import Path
-from typing import List, Optional, Tuple
+from typing import Dict, List, Optional, Tuple
 
 logger = logging.getLogger(__name__)
 
@@ -26,13 +27,21 @@ class GoDocExtractor:
             package_path: Optional path to the Go package directory.
         """
         self.package_path = package_path
+        self._go_available: Optional[bool] = None
+        self._doc_cache: Dict[str, str] = {}
 
     def check_go_available(self) -> bool:
         """Check if Go is installed and available.
 
+        The probe result is memoized per extractor, so documenting many
+        packages spawns the toolchain check once instead of once per package.
+
         Returns:
             True if Go is available, False otherwise.
         """
+        if self._go_available is not None:
+            return self._go_available
+
         try:
             result = subprocess.run(
                 ["go", "version"],
@@ -40,9 +49,10 @@ class GoDocExtractor:
                 text=True,
                 timeout=5,
             )
-            return result.returncode == 0
+            self._go_available = result.returncode == 0
         except (subprocess.TimeoutExpired, FileNotFoundError):
-            return False
+            self._go_available = False
+        return self._go_available
 
     def extract_package_doc(self, package_name: str) -> Optional[str]:
         """Extract documentation for a Go package using go doc.
@@ -57,6 +67,10 @@ class GoDocExtractor:
             logger.warning("Go is not installed - skipping documentation extraction")
             return None
 
+        cached = self._doc_cache.get(package_name)
+        if cached is not None:
+            return cached
+
         try:
             cmd = ["go", "doc", "-all", package_name]
             if self.package_path:
@@ -78,6 +92,7 @@ class GoDocExtractor:
 
             if result.returncode == 0:
                 logger.info(f"Successfully extracted documentation for {package_name}")
+                self._doc_cache[package_name] = result.stdout
                 return result.stdout
             else:
                 logger.warning(f"go doc failed for {package_name}: {result.stderr}")
@@ -208,3 +223,37 @@ class GoDocExtractor:
             success, content = self.extract_and_convert(package_name)
             results.append((package_name, success, content))
         return results
+
+    def extract_packages_parallel(
+        self, package_names: List[str], jobs: int = 4
+    ) -> List[Tuple[str, bool, str]]:
+        """Extract documentation for multiple Go packages concurrently.
+
+        Each `go doc` invocation spends most of its time in toolchain
+        startup, so overlapping the subprocesses in a small thread pool
+        recovers most of that cost. The availability probe runs once for
+        the whole batch and results are returned in input order, matching
+        extract_multiple_packages().
+
+        Args:
+            package_names: List of package names to document.
+            jobs: Maximum number of concurrent `go doc` invocations.
+
+        Returns:
+            List of tuples: (package_name, success, rst_content)
+        """
+        if len(package_names) < 2:
+            return self.extract_multiple_packages(package_names)
+
+        # Probe the toolchain once up front so worker threads reuse the result
+        self.check_go_available()
+
+        with ThreadPoolExecutor(max_workers=min(jobs, len(package_names))) as executor:
+            futures = [
+                executor.submit(self.extract_and_convert, package_name)
+                for package_name in package_names
+            ]
+            return [
+                (package_name, *future.result())
+                for package_name, future in zip(package_names, futures)
+            ]
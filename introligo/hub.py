@@ -8,13 +8,20 @@ across multiple formats (Markdown, RST, text) scattered throughout a repository.
 Copyright (c) 2025 WT Tech Jakub Brzezowski
 """
 
+import json
 import logging
+import os
 import re
 from pathlib import Path
 from typing import Any, Dict, List
 
 logger = logging.getLogger(__name__)
 
+# How much of a candidate file is read when extracting titles or
+# categorizing by content. Titles and category keywords live at the top of
+# documents, so bounded reads keep discovery fast on large files.
+_MAX_PROBE_BYTES = 65536
+
 
 class DocumentType:
     """Enumeration of document types that can be auto-discovered."""
@@ -48,6 +55,9 @@ class DocumentationHub:
         self.hub_config = config.get("hub", {})
         self.discovery_config = config.get("discovery", {})
         self.discovered_docs: List[Dict[str, Any]] = []
+        self._file_index: Dict[Path, List[Path]] = {}
+        self._discovery_cache: Dict[str, Dict[str, Any]] = {}
+        self._discovery_cache_dirty = False
 
     def is_enabled(self) -> bool:
         """Check if hub mode is enabled.
@@ -69,6 +79,8 @@ class DocumentationHub:
 
         logger.info("Discovering documentation files...")
 
+        self._load_discovery_cache()
+
         discovered = []
         repo_root = self.config_file.parent
 
@@ -95,8 +107,175 @@ class DocumentationHub:
         self.discovered_docs = discovered
         logger.info(f"✅ Discovered {len(discovered)} documentation files")
 
+        self._save_discovery_cache()
+
         return discovered
 
+    def _cache_enabled(self) -> bool:
+        """Check if the persistent discovery cache is enabled.
+
+        Returns:
+            True unless the discovery config sets ``cache: false``.
+        """
+        return bool(self.discovery_config.get("cache", True))
+
+    def get_discovery_cache_path(self) -> Path:
+        """Get the path of the persistent discovery cache.
+
+        Returns:
+            Cache file path next to the hub configuration file.
+        """
+        return self.config_file.parent / ".introligo_hub_cache.json"
+
+    def _load_discovery_cache(self) -> None:
+        """Load cached titles and categories from a previous run."""
+        self._discovery_cache = {}
+        self._discovery_cache_dirty = False
+        if not self._cache_enabled():
+            return
+
+        cache_path = self.get_discovery_cache_path()
+        if not cache_path.exists():
+            return
+
+        try:
+            data = json.loads(cache_path.read_text(encoding="utf-8"))
+            if isinstance(data, dict):
+                self._discovery_cache = data
+        except (OSError, json.JSONDecodeError) as e:
+            logger.warning(f"Ignoring unreadable discovery cache {cache_path}: {e}")
+
+    def _save_discovery_cache(self) -> None:
+        """Persist the discovery cache if any entries changed."""
+        if not self._cache_enabled() or not self._discovery_cache_dirty:
+            return
+
+        cache_path = self.get_discovery_cache_path()
+        try:
+            cache_path.write_text(
+                json.dumps(self._discovery_cache, indent=2, sort_keys=True), encoding="utf-8"
+            )
+            logger.info(f"Saved discovery cache: {cache_path}")
+        except OSError as e:
+            logger.warning(f"Failed to save discovery cache {cache_path}: {e}")
+
+    def _probe_file(self, file_path: Path, root: Path) -> Dict[str, Any]:
+        """Get title and content category for a file, using the cache.
+
+        Files whose mtime and size are unchanged since the last run are
+        served from the cache without being opened; everything else is read
+        once and both title and category are extracted from a single probe.
+
+        Args:
+            file_path: Path to the candidate file.
+            root: Repository root for the cache key.
+
+        Returns:
+            Dictionary with 'title' and 'category' keys.
+        """
+        key = file_path.relative_to(root).as_posix()
+        try:
+            stat = file_path.stat()
+        except OSError:
+            stat = None
+
+        if stat is not None:
+            entry = self._discovery_cache.get(key)
+            if (
+                entry
+                and entry.get("mtime") == stat.st_mtime
+                and entry.get("size") == stat.st_size
+            ):
+                return entry
+
+        entry = {
+            "title": self._extract_title_from_file(file_path),
+            "category": self._categorize_by_content(file_path),
+        }
+        if stat is not None:
+            entry["mtime"] = stat.st_mtime
+            entry["size"] = stat.st_size
+            self._discovery_cache[key] = entry
+            self._discovery_cache_dirty = True
+        return entry
+
+    def _get_exclude_patterns(self) -> List[str]:
+        """Get the combined built-in and user-defined exclusion patterns.
+
+        Returns:
+            List of substring patterns matched against relative paths.
+        """
+        exclude_patterns = [
+            "node_modules",
+            ".git",
+            "__pycache__",
+            ".venv",
+            "venv",
+            ".tox",
+            "build",
+            "dist",
+            "_build",
+            ".pytest_cache",
+        ]
+        exclude_patterns.extend(self.discovery_config.get("exclude_patterns", []))
+        return exclude_patterns
+
+    def _get_file_index(self, base: Path, root: Path) -> List[Path]:
+        """Get all non-excluded files under a directory from a single walk.
+
+        The walk prunes excluded subtrees at the directory level, so e.g.
+        node_modules is never descended into, and the result is cached for
+        the lifetime of the hub so every discoverer shares one traversal.
+
+        Args:
+            base: Directory to walk.
+            root: Repository root for relative path calculation.
+
+        Returns:
+            Sorted list of file paths under the directory.
+        """
+        cached = self._file_index.get(base)
+        if cached is not None:
+            return cached
+
+        exclude_patterns = self._get_exclude_patterns()
+        files: List[Path] = []
+        for dirpath, dirnames, filenames in os.walk(base):
+            dir_path = Path(dirpath)
+            # Prune excluded directories so their subtrees are never visited
+            dirnames[:] = sorted(
+                d
+                for d in dirnames
+                if not any(
+                    exclude in str((dir_path / d).relative_to(root)) for exclude in exclude_patterns
+                )
+            )
+            for filename in sorted(filenames):
+                file_path = dir_path / filename
+                relative = str(file_path.relative_to(root))
+                if not any(exclude in relative for exclude in exclude_patterns):
+                    files.append(file_path)
+
+        self._file_index[base] = files
+        return files
+
+    def _iter_scan_files(self, root: Path) -> List[Path]:
+        """Iterate all indexed files across the configured scan paths.
+
+        Args:
+            root: Repository root to resolve scan paths against.
+
+        Returns:
+            List of file paths from every existing scan path.
+        """
+        files: List[Path] = []
+        for scan_path in self.discovery_config.get("scan_paths", ["."]):
+            search_dir = root / scan_path
+            if not search_dir.exists():
+                continue
+            files.extend(self._get_file_index(search_dir, root))
+        return files
+
     def _discover_readmes(self, root: Path) -> List[Dict[str, Any]]:
         """Discover README files.
 
@@ -107,28 +286,20 @@ class DocumentationHub:
             List of discovered README files with metadata.
         """
         readmes = []
-        scan_paths = self.discovery_config.get("scan_paths", ["."])
-
-        for scan_path in scan_paths:
-            search_dir = root / scan_path
-            if not search_dir.exists():
+        for readme_file in self._iter_scan_files(root):
+            if readme_file.name != "README.md":
                 continue
 
-            # Look for README files (case-insensitive)
-            for readme_file in search_dir.glob("**/README.md"):
-                if self._should_exclude(readme_file, root):
-                    continue
-
-                readmes.append(
-                    {
-                        "type": DocumentType.README,
-                        "path": readme_file,
-                        "relative_path": readme_file.relative_to(root),
-                        "title": self._extract_title_from_file(readme_file),
-                        "category": self._categorize_readme(readme_file, root),
-                    }
-                )
-                logger.info(f"  Found README: {readme_file.relative_to(root)}")
+            readmes.append(
+                {
+                    "type": DocumentType.README,
+                    "path": readme_file,
+                    "relative_path": readme_file.relative_to(root),
+                    "title": self._probe_file(readme_file, root)["title"],
+                    "category": self._categorize_readme(readme_file, root),
+                }
+            )
+            logger.info(f"  Found README: {readme_file.relative_to(root)}")
 
         return readmes
 
@@ -142,29 +313,20 @@ class DocumentationHub:
             List of discovered CHANGELOG files with metadata.
         """
         changelogs = []
-        scan_paths = self.discovery_config.get("scan_paths", ["."])
-
-        for scan_path in scan_paths:
-            search_dir = root / scan_path
-            if not search_dir.exists():
+        for changelog_file in self._iter_scan_files(root):
+            if changelog_file.name not in ("CHANGELOG.md", "CHANGELOG", "HISTORY.md"):
                 continue
 
-            # Look for CHANGELOG files
-            for pattern in ["**/CHANGELOG.md", "**/CHANGELOG", "**/HISTORY.md"]:
-                for changelog_file in search_dir.glob(pattern):
-                    if self._should_exclude(changelog_file, root):
-                        continue
-
-                    changelogs.append(
-                        {
-                            "type": DocumentType.CHANGELOG,
-                            "path": changelog_file,
-                            "relative_path": changelog_file.relative_to(root),
-                            "title": "Changelog",
-                            "category": "about",
-                        }
-                    )
-                    logger.info(f"  Found CHANGELOG: {changelog_file.relative_to(root)}")
+            changelogs.append(
+                {
+                    "type": DocumentType.CHANGELOG,
+                    "path": changelog_file,
+                    "relative_path": changelog_file.relative_to(root),
+                    "title": "Changelog",
+                    "category": "about",
+                }
+            )
+            logger.info(f"  Found CHANGELOG: {changelog_file.relative_to(root)}")
 
         return changelogs
 
@@ -178,28 +340,20 @@ class DocumentationHub:
             List of discovered CONTRIBUTING files with metadata.
         """
         contributing = []
-        scan_paths = self.discovery_config.get("scan_paths", ["."])
-
-        for scan_path in scan_paths:
-            search_dir = root / scan_path
-            if not search_dir.exists():
+        for contrib_file in self._iter_scan_files(root):
+            if contrib_file.name not in ("CONTRIBUTING.md", "CONTRIBUTING"):
                 continue
 
-            for pattern in ["**/CONTRIBUTING.md", "**/CONTRIBUTING"]:
-                for contrib_file in search_dir.glob(pattern):
-                    if self._should_exclude(contrib_file, root):
-                        continue
-
-                    contributing.append(
-                        {
-                            "type": DocumentType.CONTRIBUTING,
-                            "path": contrib_file,
-                            "relative_path": contrib_file.relative_to(root),
-                            "title": "Contributing",
-                            "category": "about",
-                        }
-                    )
-                    logger.info(f"  🤝 Found CONTRIBUTING: {contrib_file.relative_to(root)}")
+            contributing.append(
+                {
+                    "type": DocumentType.CONTRIBUTING,
+                    "path": contrib_file,
+                    "relative_path": contrib_file.relative_to(root),
+                    "title": "Contributing",
+                    "category": "about",
+                }
+            )
+            logger.info(f"  🤝 Found CONTRIBUTING: {contrib_file.relative_to(root)}")
 
         return contributing
 
@@ -213,31 +367,57 @@ class DocumentationHub:
             List of discovered LICENSE files with metadata.
         """
         licenses = []
-        scan_paths = self.discovery_config.get("scan_paths", ["."])
-
-        for scan_path in scan_paths:
-            search_dir = root / scan_path
-            if not search_dir.exists():
+        for license_file in self._iter_scan_files(root):
+            if license_file.name not in ("LICENSE", "LICENSE.md", "LICENSE.txt"):
                 continue
 
-            for pattern in ["**/LICENSE", "**/LICENSE.md", "**/LICENSE.txt"]:
-                for license_file in search_dir.glob(pattern):
-                    if self._should_exclude(license_file, root):
-                        continue
-
-                    licenses.append(
-                        {
-                            "type": DocumentType.LICENSE,
-                            "path": license_file,
-                            "relative_path": license_file.relative_to(root),
-                            "title": "License",
-                            "category": "about",
-                        }
-                    )
-                    logger.info(f"  ⚖️  Found LICENSE: {license_file.relative_to(root)}")
+            licenses.append(
+                {
+                    "type": DocumentType.LICENSE,
+                    "path": license_file,
+                    "relative_path": license_file.relative_to(root),
+                    "title": "License",
+                    "category": "about",
+                }
+            )
+            logger.info(f"  ⚖️  Found LICENSE: {license_file.relative_to(root)}")
 
         return licenses
 
+    @staticmethod
+    def _glob_to_regex(pattern: str) -> "re.Pattern":
+        """Translate a glob pattern (with ** support) to a path regex.
+
+        Args:
+            pattern: Glob pattern relative to the repository root.
+
+        Returns:
+            Compiled regex matching relative POSIX paths.
+        """
+
+        def translate_segment(segment: str) -> str:
+            out = []
+            for char in segment:
+                if char == "*":
+                    out.append("[^/]*")
+                elif char == "?":
+                    out.append("[^/]")
+                else:
+                    out.append(re.escape(char))
+            return "".join(out)
+
+        parts = []
+        for segment in pattern.split("/"):
+            if segment == "**":
+                # Zero or more intermediate directories
+                parts.append("(?:[^/]+/)*")
+            else:
+                parts.append(translate_segment(segment) + "/")
+        regex = "".join(parts)
+        if regex.endswith("/"):
+            regex = regex[:-1]
+        return re.compile(regex + r"\Z")
+
     def _discover_by_pattern(
         self, root: Path, pattern: str, doc_format: str
     ) -> List[Dict[str, Any]]:
@@ -252,21 +432,20 @@ class DocumentationHub:
             List of discovered files with metadata.
         """
         discovered = []
+        pattern_re = self._glob_to_regex(pattern)
 
-        for file_path in root.glob(pattern):
-            if self._should_exclude(file_path, root):
-                continue
-
-            if not file_path.is_file():
+        for file_path in self._get_file_index(root, root):
+            if not pattern_re.match(file_path.relative_to(root).as_posix()):
                 continue
 
+            probe = self._probe_file(file_path, root)
             discovered.append(
                 {
                     "type": DocumentType.GENERIC,
                     "path": file_path,
                     "relative_path": file_path.relative_to(root),
-                    "title": self._extract_title_from_file(file_path),
-                    "category": self._categorize_by_content(file_path),
+                    "title": probe["title"],
+                    "category": probe["category"],
                     "format": doc_format,
                 }
             )
@@ -284,26 +463,20 @@ class DocumentationHub:
         Returns:
             True if file should be excluded, False otherwise.
         """
-        # Common directories to exclude
-        exclude_patterns = [
-            "node_modules",
-            ".git",
-            "__pycache__",
-            ".venv",
-            "venv",
-            ".tox",
-            "build",
-            "dist",
-            "_build",
-            ".pytest_cache",
-        ]
+        relative = file_path.relative_to(root)
+        return any(exclude in str(relative) for exclude in self._get_exclude_patterns())
 
-        # User-defined exclusions
-        user_exclude = self.discovery_config.get("exclude_patterns", [])
-        exclude_patterns.extend(user_exclude)
+    def _read_probe(self, file_path: Path) -> str:
+        """Read a bounded prefix of a file for title/category extraction.
 
-        relative = file_path.relative_to(root)
-        return any(exclude in str(relative) for exclude in exclude_patterns)
+        Args:
+            file_path: Path to the file.
+
+        Returns:
+            Up to the first _MAX_PROBE_BYTES of the file's text.
+        """
+        with open(file_path, encoding="utf-8", errors="ignore") as f:
+            return f.read(_MAX_PROBE_BYTES)
 
     def _extract_title_from_file(self, file_path: Path) -> str:
         """Extract title from a file (first heading or filename).
@@ -315,7 +488,7 @@ class DocumentationHub:
             Extracted title string.
         """
         try:
-            content = file_path.read_text(encoding="utf-8", errors="ignore")
+            content = self._read_probe(file_path)
 
             # Try to find first markdown heading
             md_heading = re.search(r"^#\s+(.+)$", content, re.MULTILINE)
@@ -371,7 +544,7 @@ class DocumentationHub:
             Category string.
         """
         try:
-            content = file_path.read_text(encoding="utf-8", errors="ignore").lower()
+            content = self._read_probe(file_path).lower()
 
             # Check for API/reference keywords
             api_keywords = ["api", "reference", "class", "function", "method", "module"]
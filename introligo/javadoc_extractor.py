@@ -7,11 +7,13 @@ it to reStructuredText format for inclusion in Sphinx documentation.
 Copyright (c) 2025 WT Tech Jakub Brzezowski
 """
 
+import hashlib
 import logging
 import re
 import subprocess
+from concurrent.futures import ThreadPoolExecutor
 from pathlib import Path
-from typing import List, Optional, Tuple
+from typing import Dict, List, Optional, Tuple
 
 logger = logging.getLogger(__name__)
 
@@ -26,6 +28,9 @@ class JavaDocExtractor:
             source_path: Optional path to the Java source directory.
         """
         self.source_path = source_path
+        # Optional shared cache of converted RST keyed by source content
+        # hash, so unchanged files are never re-parsed across runs.
+        self.result_cache: Optional[Dict[str, str]] = None
 
     def check_java_available(self) -> bool:
         """Check if Java and javadoc are installed and available.
@@ -280,7 +285,16 @@ class JavaDocExtractor:
         source_content = self.extract_from_source(java_file)
 
         if source_content:
+            cache_key = None
+            if self.result_cache is not None:
+                cache_key = hashlib.sha256(source_content.encode("utf-8")).hexdigest()
+                cached = self.result_cache.get(cache_key)
+                if cached is not None:
+                    return True, cached
+
             rst_content = self.parse_java_source(source_content, class_name)
+            if self.result_cache is not None and cache_key is not None:
+                self.result_cache[cache_key] = rst_content
             return True, rst_content
         else:
             # Return a helpful message if extraction failed
@@ -317,6 +331,35 @@ class JavaDocExtractor:
             results.append((java_file.name, success, content))
         return results
 
+    def extract_files_parallel(
+        self, java_files: List[Path], jobs: int = 4
+    ) -> List[Tuple[str, bool, str]]:
+        """Extract documentation for multiple Java files concurrently.
+
+        Parsing is independent per file, so files are handed to a small
+        thread pool. Results are returned in input order, matching
+        extract_multiple_files().
+
+        Args:
+            java_files: List of Java file paths to document.
+            jobs: Maximum number of concurrent extraction jobs.
+
+        Returns:
+            List of tuples: (filename, success, rst_content)
+        """
+        if len(java_files) < 2:
+            return self.extract_multiple_files(java_files)
+
+        with ThreadPoolExecutor(max_workers=min(jobs, len(java_files))) as executor:
+            futures = [
+                executor.submit(self.extract_and_convert, java_file, java_file.stem)
+                for java_file in java_files
+            ]
+            return [
+                (java_file.name, *future.result())
+                for java_file, future in zip(java_files, futures)
+            ]
+
     def extract_package(self, package_path: Path, package_name: str) -> Tuple[bool, str]:
         """Extract documentation for an entire Java package.
 
@@ -357,8 +400,18 @@ class JavaDocExtractor:
         rst_lines.append("")
 
         any_success = False
-        for java_file in sorted(java_files):
-            success, content = self.extract_and_convert(java_file)
+        sorted_files = sorted(java_files)
+        if len(sorted_files) > 1:
+            with ThreadPoolExecutor(max_workers=min(4, len(sorted_files))) as executor:
+                futures = [
+                    executor.submit(self.extract_and_convert, java_file)
+                    for java_file in sorted_files
+                ]
+                extracted = [future.result() for future in futures]
+        else:
+            extracted = [self.extract_and_convert(java_file) for java_file in sorted_files]
+
+        for java_file, (success, content) in zip(sorted_files, extracted):
             if success:
                 any_success = True
                 rst_lines.append("")
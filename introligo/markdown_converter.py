@@ -4,26 +4,79 @@
 Copyright (c) 2025 WT Tech Jakub Brzezowski
 """
 
+import logging
 import re
-from typing import Optional
+from functools import lru_cache
+from typing import TYPE_CHECKING, Optional
 
 from .utils import count_display_width
 
+if TYPE_CHECKING:
+    from .anchor_registry import AnchorRegistry
+
+logger = logging.getLogger(__name__)
+
+# Precompiled patterns for the single-pass converter. Compiling once at import
+# time keeps per-line dispatch cheap when converting multi-megabyte documents.
+_FENCE_RE = re.compile(r"^(\s*)(```+)(.*)$")
+_CHECKBOX_ITEM_RE = re.compile(r"^-\s+\[([xX ])\]\s+(.+)$")
+_CHECKBOX_START_RE = re.compile(r"^-\s+\[[xX ]\]\s+")
+_HEADER_RE = re.compile(r"^(#{1,5}) (.*)$")
+_INLINE_CODE_RE = re.compile(r"`([^`]+)`")
+
+# Header underline characters by level: (demoted, non-demoted).
+# Demotion shifts every header down one level so included files do not
+# introduce duplicate H1 headers.
+_HEADER_UNDERLINES = {
+    1: ("-", "="),
+    2: ("~", "-"),
+    3: ("^", "~"),
+    4: ('"', "^"),
+    5: (",", ":"),
+}
+
+# Images are rewritten in their own pass so badge-style nested links
+# ([![alt](img)](target)) expose the outer link to the combined pass below.
+_IMAGE_RE = re.compile(r"!\[(?P<img_alt>[^\]]*)\]\((?P<img_path>[^)]+)\)")
+
+# Combined link alternation: the remaining markdown link forms are classified
+# and rewritten in a single pass over the text. Alternatives are ordered by
+# priority, matching the order of the former per-form substitution passes.
+_LINK_RE = re.compile(
+    r"\[(?P<ext_text>[^\]]+)\]\((?P<ext_url>https?://[^)]+)\)"
+    r"|\[(?P<danc_text>[^\]]+)\]\((?P<danc_path>[^)#:]+\.(?:md|rst))#(?P<danc_anchor>[^)]+)\)"
+    r"|\[(?P<anc_text>[^\]]+)\]\(#(?P<anc_anchor>[^)]+)\)"
+    r"|\[(?P<doc_text>[^\]]+)\]\((?P<doc_path>[^)#:]+\.(?:md|rst))\)"
+    r"|\[(?P<rel_text>[^\]]+)\]\((?P<rel_path>\./[^)#:]+|\.\./[^)#:]+)\)"
+)
+
+
+def _strip_doc_extension(file_path: str) -> str:
+    """Strip .md/.rst extensions and a leading ./ from a document link path.
 
-def create_label_from_title(title: str, add_labels: bool = True) -> str:
-    """Create a valid RST label from a title.
+    Args:
+        file_path: Link target path from a markdown link.
+
+    Returns:
+        Path suitable for a Sphinx :doc: reference.
+    """
+    doc_path = file_path.replace(".md", "").replace(".rst", "")
+    if doc_path.startswith("./"):
+        doc_path = doc_path[2:]
+    # ../ prefixed paths are kept as-is
+    return doc_path
+
+
+@lru_cache(maxsize=4096)
+def _label_from_title(title: str) -> str:
+    """Compute a valid RST label from a title (memoized).
 
     Args:
         title: The header title text.
-        add_labels: If True, creates label anchors for headers. If False, returns empty string.
-                   Default is True for backwards compatibility.
 
     Returns:
-        A valid RST label string, or empty string if add_labels is False.
+        A valid RST label string.
     """
-    if not add_labels:
-        return ""
-
     # Convert to lowercase and replace spaces with hyphens
     label = title.lower()
     # Remove or replace special characters
@@ -34,7 +87,27 @@ def create_label_from_title(title: str, add_labels: bool = True) -> str:
     return label
 
 
-def convert_markdown_links_to_rst(text: str) -> str:
+def create_label_from_title(title: str, add_labels: bool = True) -> str:
+    """Create a valid RST label from a title.
+
+    Args:
+        title: The header title text.
+        add_labels: If True, creates label anchors for headers. If False, returns empty string.
+                   Default is True for backwards compatibility.
+
+    Returns:
+        A valid RST label string, or empty string if add_labels is False.
+    """
+    if not add_labels:
+        return ""
+    return _label_from_title(title)
+
+
+def convert_markdown_links_to_rst(
+    text: str,
+    registry: Optional["AnchorRegistry"] = None,
+    source: Optional[str] = None,
+) -> str:
     """Convert markdown links to RST format.
 
     Handles:
@@ -50,41 +123,55 @@ def convert_markdown_links_to_rst(text: str) -> str:
 
     Args:
         text: Line of text potentially containing markdown links.
+        registry: Optional anchor registry used to validate link targets.
+        source: Source path the text came from, for anchor validation.
 
     Returns:
         Text with links converted to RST format.
     """
     # Handle images first: ![alt](path)
-    text = re.sub(
-        r"!\[([^\]]*)\]\(([^)]+)\)",
-        lambda m: f"\n\n.. image:: {m.group(2)}\n   :alt: {m.group(1)}\n\n",
+    text = _IMAGE_RE.sub(
+        lambda m: f"\n\n.. image:: {m.group('img_path')}\n   :alt: {m.group('img_alt')}\n\n",
         text,
     )
+    return _LINK_RE.sub(lambda m: _rewrite_link(m, registry, source), text)
 
-    # Handle external links with anchors: [text](http://...#anchor or https://...#anchor)
-    text = re.sub(
-        r"\[([^\]]+)\]\((https?://[^)]+)\)", lambda m: f"`{m.group(1)} <{m.group(2)}>`_", text
-    )
 
-    # Handle internal document links with anchors: [text](./file.md#anchor)
-    # Convert to :doc: reference with note about the section
-    def convert_doc_link_with_anchor(match):
-        """Convert markdown link with anchor to RST doc reference."""
-        link_text = match.group(1)
-        file_path = match.group(2)
-        anchor = match.group(3)
-
-        # Remove .md/.rst extension and leading ./
-        doc_path = file_path.replace(".md", "").replace(".rst", "")
-        if doc_path.startswith("./"):
-            doc_path = doc_path[2:]
-        elif doc_path.startswith("../"):
-            # Keep relative paths as-is
-            pass
+def _rewrite_link(
+    match: "re.Match",
+    registry: Optional["AnchorRegistry"] = None,
+    source: Optional[str] = None,
+) -> str:
+    """Rewrite a single matched markdown link to its RST form.
+
+    When a registry is given, link targets are validated against it with
+    O(1) lookups: anchors that match no heading of the source document are
+    reported as warnings, and doc targets unknown to the registry are
+    logged at debug level (they may legitimately point at documents
+    outside the generated tree).
+
+    Args:
+        match: Match object from the combined link alternation.
+        registry: Optional anchor registry used to validate link targets.
+        source: Source path the text came from, for anchor validation.
+
+    Returns:
+        RST replacement text for the matched link.
+    """
+    groups = match.groupdict()
+
+    # External links: [text](http://url) or [text](https://url#anchor)
+    if groups["ext_url"] is not None:
+        return f"`{groups['ext_text']} <{groups['ext_url']}>`_"
+
+    # Internal document links with anchors: [text](./file.md#anchor)
+    if groups["danc_path"] is not None:
+        link_text = groups["danc_text"]
+        doc_path = _strip_doc_extension(groups["danc_path"])
 
         # Create a more informative link text that includes the section
         # This helps users know which section they're linking to
-        section_name = anchor.replace("-", " ").replace("_", " ").title()
+        section_name = groups["danc_anchor"].replace("-", " ").replace("_", " ").title()
 
         # If link text already mentions the section, use it as-is
         if link_text != section_name and section_name.lower() not in link_text.lower():
@@ -92,49 +179,53 @@ def convert_markdown_links_to_rst(text: str) -> str:
         else:
             combined_text = link_text
 
+        _validate_doc_target(registry, doc_path, source)
         return f":doc:`{combined_text} <{doc_path}>`"
 
-    text = re.sub(
-        r"\[([^\]]+)\]\(([^)#:]+\.(?:md|rst))#([^)]+)\)", convert_doc_link_with_anchor, text
-    )
+    # Anchor-only links: [text](#anchor)
+    if groups["anc_anchor"] is not None:
+        anchor = groups["anc_anchor"]
+        if registry is not None and source is not None:
+            if registry.resolve_heading(source, anchor) is None:
+                logger.warning(f"⚠️ Anchor '#{anchor}' matches no heading in {source}")
+        return f":ref:`{anchor}`"
 
-    # Handle anchor-only links: [text](#anchor)
-    text = re.sub(r"\[([^\]]+)\]\(#([^)]+)\)", lambda m: f":ref:`{m.group(2)}`", text)
-
-    # Handle internal document links without anchors:
-    # [text](./file.md) or [text](path/to/file.md)
-    # Convert to :doc: reference without .md extension
-    def convert_doc_link(match):
-        """Convert markdown link to RST doc reference."""
-        link_text = match.group(1)
-        file_path = match.group(2)
-
-        # Remove .md extension and leading ./
-        doc_path = file_path.replace(".md", "").replace(".rst", "")
-        if doc_path.startswith("./"):
-            doc_path = doc_path[2:]
-        elif doc_path.startswith("../"):
-            # Keep relative paths as-is for now
-            pass
+    # Internal document links without anchors: [text](./file.md)
+    if groups["doc_path"] is not None:
+        link_text = groups["doc_text"]
+        doc_path = _strip_doc_extension(groups["doc_path"])
+        _validate_doc_target(registry, doc_path, source)
 
         # For simple cases, use the link as-is
         # Sphinx will handle the resolution
         if link_text != doc_path:
             return f":doc:`{link_text} <{doc_path}>`"
-        else:
-            return f":doc:`{doc_path}`"
+        return f":doc:`{doc_path}`"
 
-    text = re.sub(r"\[([^\]]+)\]\(([^)#:]+\.(?:md|rst))\)", convert_doc_link, text)
+    # Remaining local file links without extension: [text](./path/to/doc)
+    rel_path = groups["rel_path"].replace("./", "").replace("../", "")
+    return f":doc:`{groups['rel_text']} <{rel_path}>`"
 
-    # Handle remaining local file links (without extension)
-    # These might be relative paths like [text](./path/to/doc)
-    text = re.sub(
-        r"\[([^\]]+)\]\((\./[^)#:]+|\.\.\/[^)#:]+)\)",
-        lambda m: f":doc:`{m.group(1)} <{m.group(2).replace('./', '').replace('../', '')}>`",
-        text,
-    )
 
-    return text
+def _validate_doc_target(
+    registry: Optional["AnchorRegistry"], doc_path: str, source: Optional[str]
+) -> None:
+    """Check a :doc: link target against the registered page slugs.
+
+    The registry only covers introligo-generated pages, so an unknown
+    target is not necessarily broken - it is logged at debug level to aid
+    diagnosis without producing false-positive warnings.
+
+    Args:
+        registry: Optional anchor registry of generated pages.
+        doc_path: Target path of the :doc: reference.
+        source: Source path the link came from, for the log message.
+    """
+    if registry is None:
+        return
+    slug = doc_path.rsplit("/", 1)[-1]
+    if registry.resolve_page(slug) is None:
+        logger.debug(f"Doc link target '{doc_path}' not found among generated pages ({source})")
 
 
 def convert_markdown_table_to_rst(lines: list, start_index: int) -> tuple:
@@ -223,7 +314,7 @@ def convert_checkbox_list_to_html(lines: list, start_index: int) -> tuple:
     while i < len(lines):
         line = lines[i].strip()
         # Match checkbox list items: - [ ] or - [x] or - [X]
-        if re.match(r"^-\s+\[[xX ]\]\s+", line):
+        if _CHECKBOX_START_RE.match(line):
             checkbox_lines.append(lines[i])
             i += 1
         else:
@@ -239,13 +330,13 @@ def convert_checkbox_list_to_html(lines: list, start_index: int) -> tuple:
 
     for line in checkbox_lines:
         # Extract checkbox state and text
-        match = re.match(r"^-\s+\[([xX ])\]\s+(.+)$", line.strip())
+        match = _CHECKBOX_ITEM_RE.match(line.strip())
         if match:
             state = match.group(1)
             text = match.group(2)
 
             # Escape backticks in text by converting them to <code> tags
-            text = re.sub(r"`([^`]+)`", r"<code>\1</code>", text)
+            text = _INLINE_CODE_RE.sub(r"<code>\1</code>", text)
 
             # Create checkbox HTML
             if state.lower() == "x":
@@ -286,6 +377,8 @@ def convert_markdown_to_rst(
     doc_type: Optional[str] = None,
     demote_headers: bool = True,
     add_labels: bool = False,
+    registry: Optional["AnchorRegistry"] = None,
+    source: Optional[str] = None,
 ) -> str:
     """Convert basic markdown syntax to reStructuredText.
 
@@ -296,6 +389,9 @@ def convert_markdown_to_rst(
                        to avoid duplicate H1 headers when including files. Default is True.
         add_labels: If True, adds RST label anchors for headers. Default is False to avoid
                    duplicate label warnings when same headers appear in multiple files.
+        registry: Optional anchor registry; headings are registered under
+                 `source` and link targets are validated against it.
+        source: Source path of the markdown content, used as the registry key.
 
     Returns:
         RST-compatible content.
@@ -311,6 +407,19 @@ def convert_markdown_to_rst(
     }
 
     lines = markdown.split("\n")
+
+    # Register every heading up front so anchor links that appear before
+    # their target heading still validate against the complete set
+    if registry is not None and source is not None:
+        in_fence = False
+        for raw_line in lines:
+            if _FENCE_RE.match(raw_line):
+                in_fence = not in_fence
+                continue
+            header = _HEADER_RE.match(raw_line) if not in_fence else None
+            if header:
+                registry.register_heading(source, header.group(2).strip())
+
     result = []
     in_code_block = False
     code_language = ""
@@ -327,7 +436,7 @@ def convert_markdown_to_rst(
         line = lines[i]
 
         # Handle code blocks - support 3 or more backticks
-        backtick_match = re.match(r"^(\s*)(```+)(.*)$", line)
+        backtick_match = _FENCE_RE.match(line)
         if backtick_match:
             fence = backtick_match.group(2)
             lang = backtick_match.group(3).strip()
@@ -369,7 +478,7 @@ def convert_markdown_to_rst(
                 continue
 
         # Handle checkbox lists (before link conversion)
-        if re.match(r"^-\s+\[[xX ]\]\s+", line.strip()) and not in_code_block:
+        if _CHECKBOX_START_RE.match(line.strip()) and not in_code_block:
             # This is a checkbox list!
             rst_checkbox, new_index = convert_checkbox_list_to_html(lines, i)
             if rst_checkbox:
@@ -378,7 +487,7 @@ def convert_markdown_to_rst(
                 continue
 
         # Convert markdown links to RST (before processing headers)
-        line = convert_markdown_links_to_rst(line)
+        line = convert_markdown_links_to_rst(line, registry, source)
 
         # Handle nested bullet lists - add blank lines for level transitions
         # This fixes RST "Unexpected indentation" errors
@@ -400,88 +509,27 @@ def convert_markdown_to_rst(
             prev_list_indent = -1
             prev_list_ended_with_colon = False
 
-        # Handle headers
+        # Handle headers via the underline dispatch table
         # When demote_headers is True:
         # H1 (#) -> H2 (----)
         # H2 (##) -> H3 (~~~~)
         # H3 (###) -> H4 (^^^^)
         # H4 (####) -> H5 ("""""")
         # H5 (#####) -> H6 (,,,,,,)
-
-        if line.startswith("##### "):
-            # H5 -> H6 (when demoted)
-            title = line[6:].strip()
-            title_width = count_display_width(title)
-            # Add anchor label for cross-referencing (if enabled)
-            label = create_label_from_title(title, add_labels)
-            result.append("")
-            if label:
-                result.append(f".. _{label}:")
-                result.append("")
-            result.append(title)
-            if demote_headers:
-                result.append("," * title_width)
-            else:
-                result.append(":" * title_width)
-            result.append("")
-        elif line.startswith("#### "):
-            # H4 -> H5 (when demoted)
-            title = line[5:].strip()
-            title_width = count_display_width(title)
-            # Add anchor label for cross-referencing (if enabled)
-            label = create_label_from_title(title, add_labels)
-            result.append("")
-            if label:
-                result.append(f".. _{label}:")
-                result.append("")
-            result.append(title)
-            if demote_headers:
-                result.append('"' * title_width)
-            else:
-                result.append("^" * title_width)
-            result.append("")
-        elif line.startswith("### "):
-            # H3 -> H4 (when demoted)
-            title = line[4:].strip()
-            title_width = count_display_width(title)
-            # Add anchor label for cross-referencing (if enabled)
-            label = create_label_from_title(title, add_labels)
-            result.append("")
-            if label:
-                result.append(f".. _{label}:")
-                result.append("")
-            result.append(title)
-            if demote_headers:
-                result.append("^" * title_width)
-            else:
-                result.append("~" * title_width)
-            result.append("")
-        elif line.startswith("## "):
-            # H2 -> H3 (when demoted)
-            title = line[3:].strip()
-            title_width = count_display_width(title)
-            # Add anchor label for cross-referencing (if enabled)
-            label = create_label_from_title(title, add_labels)
-            result.append("")
-            if label:
-                result.append(f".. _{label}:")
-                result.append("")
-            result.append(title)
-            if demote_headers:
-                result.append("~" * title_width)
-            else:
-                result.append("-" * title_width)
-            result.append("")
-        elif line.startswith("# "):
-            # H1 -> H2 (when demoted)
-            title = line[2:].strip()
-            title_width = count_display_width(title)
+        header_match = _HEADER_RE.match(line)
+        if header_match:
+            level = len(header_match.group(1))
+            title = header_match.group(2).strip()
             # Skip first H1 for changelogs or if title matches doc type
-            if skip_first_h1 and not first_h1_found:
+            if level == 1:
+                if skip_first_h1 and not first_h1_found:
+                    first_h1_found = True
+                    i += 1
+                    continue
                 first_h1_found = True
-                i += 1
-                continue
-            first_h1_found = True
+            title_width = count_display_width(title)
+            demoted_char, normal_char = _HEADER_UNDERLINES[level]
+            underline_char = demoted_char if demote_headers else normal_char
             # Add anchor label for cross-referencing (if enabled)
             label = create_label_from_title(title, add_labels)
             result.append("")
@@ -489,10 +537,7 @@ def convert_markdown_to_rst(
                 result.append(f".. _{label}:")
                 result.append("")
             result.append(title)
-            if demote_headers:
-                result.append("-" * title_width)
-            else:
-                result.append("=" * title_width)
+            result.append(underline_char * title_width)
             result.append("")
         else:
             # Regular line
@@ -5,7 +5,8 @@ Copyright (c) 2025 WT Tech Jakub Brzezowski
 """
 
 from pathlib import Path
-from typing import Any, Dict, List, Optional
+from sys import intern
+from typing import Any, Dict, List, Optional, Tuple
 
 from .utils import slugify
 
@@ -27,9 +28,15 @@ class PageNode:
         self.children: List[PageNode] = []
 
         self.title = config.get("title", page_id)
-        self.slug = slugify(self.title)
+        # Slugs repeat across deep trees, so intern them to share storage
+        self.slug = intern(slugify(self.title))
         self.path = Path(self.slug)
 
+        # Precomputed path index filled by compute_paths() once the tree is
+        # built: base dir -> (output_dir, output_file)
+        self._path_index: Dict[Path, Tuple[Path, Path]] = {}
+        self._relative_path_cache: Dict[Tuple[Path, Path], str] = {}
+
     def get_rst_filename(self) -> str:
         """Get the RST filename for this page.
 
@@ -38,6 +45,24 @@ class PageNode:
         """
         return f"{self.slug}.rst"
 
+    def compute_paths(self, base_generated_dir: Path) -> None:
+        """Precompute and cache this page's output paths for a base directory.
+
+        Called once per node during build_page_tree() so path resolution
+        while rendering toctrees and index references becomes a dictionary
+        lookup instead of a parent-pointer walk per call.
+
+        Args:
+            base_generated_dir: Base directory for generated files.
+        """
+        lineage: List[str] = []
+        node = self.parent
+        while node:
+            lineage.insert(0, node.slug)
+            node = node.parent
+        output_dir = base_generated_dir.joinpath(*lineage)
+        self._path_index[base_generated_dir] = (output_dir, output_dir / self.get_rst_filename())
+
     def get_output_dir(self, base_generated_dir: Path) -> Path:
         """Get the full output directory path for this page (with full lineage).
 
@@ -47,6 +72,9 @@ class PageNode:
         Returns:
             Full path to the output directory for this page.
         """
+        cached = self._path_index.get(base_generated_dir)
+        if cached is not None:
+            return cached[0]
         lineage: List[str] = []
         node = self.parent
         while node:
@@ -63,6 +91,9 @@ class PageNode:
         Returns:
             Full path to the output RST file.
         """
+        cached = self._path_index.get(base_generated_dir)
+        if cached is not None:
+            return cached[1]
         return self.get_output_dir(base_generated_dir) / self.get_rst_filename()
 
     def get_relative_path_from(self, other_dir: Path, base_generated_dir: Path) -> str:
@@ -75,6 +106,15 @@ class PageNode:
         Returns:
             Relative path string for use in Sphinx toctree.
         """
+        # Only memoize once compute_paths() has frozen this base directory,
+        # so ad-hoc nodes with late-assigned parents stay correct
+        memoizable = base_generated_dir in self._path_index
+        cache_key = (other_dir, base_generated_dir)
+        if memoizable:
+            cached_path = self._relative_path_cache.get(cache_key)
+            if cached_path is not None:
+                return cached_path
+
         self_path = self.get_output_file(base_generated_dir)
         try:
             # Calculate path relative to the parent's directory
@@ -85,7 +125,10 @@ class PageNode:
                 relative = self_path.relative_to(base_generated_dir).with_suffix("")
             except ValueError:
                 relative = self_path.with_suffix("")
-        return str(relative).replace("\\", "/")
+        relative_str = str(relative).replace("\\", "/")
+        if memoizable:
+            self._relative_path_cache[cache_key] = relative_str
+        return relative_str
 
     def is_leaf(self) -> bool:
         """Check if this node is a leaf (has no children).
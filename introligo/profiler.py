@@ -0,0 +1,161 @@
+#!/usr/bin/env python
+"""Lightweight wall-time profiler for Introligo generation runs.
+
+Collects per-phase, per-page and per-helper timings behind the --profile
+CLI flag, renders a human-readable summary and can export the raw data
+as JSON for dashboards.
+
+Copyright (c) 2025 WT Tech Jakub Brzezowski
+"""
+
+import json
+import threading
+import time
+from contextlib import contextmanager
+from pathlib import Path
+from typing import Any, Dict, Iterator, List, Tuple
+
+
+class Profiler:
+    """Accumulates wall-clock timings for a single generation run.
+
+    Timings are grouped into three categories:
+
+    - phases: coarse pipeline stages (load_config, render, write, ...)
+    - pages: time spent rendering each PageNode
+    - helpers: time inside include_* conversions and doc extractors
+
+    All recording methods are thread-safe so parallel page rendering can
+    report into the same profiler.
+    """
+
+    def __init__(self) -> None:
+        """Initialize an empty profiler and start the run clock."""
+        self.phases: Dict[str, float] = {}
+        self.pages: Dict[str, float] = {}
+        self.helpers: Dict[str, float] = {}
+        self._lock = threading.Lock()
+        self._run_start = time.perf_counter()
+
+    def _record(self, bucket: Dict[str, float], name: str, seconds: float) -> None:
+        """Accumulate a measurement into one of the timing buckets."""
+        with self._lock:
+            bucket[name] = bucket.get(name, 0.0) + seconds
+
+    @contextmanager
+    def phase(self, name: str) -> Iterator[None]:
+        """Time a pipeline phase.
+
+        Args:
+            name: Phase name, e.g. "load_config" or "render".
+        """
+        start = time.perf_counter()
+        try:
+            yield
+        finally:
+            self._record(self.phases, name, time.perf_counter() - start)
+
+    @contextmanager
+    def page(self, page_id: str) -> Iterator[None]:
+        """Time the rendering of a single page.
+
+        Args:
+            page_id: Identifier of the page being rendered.
+        """
+        start = time.perf_counter()
+        try:
+            yield
+        finally:
+            self._record(self.pages, page_id, time.perf_counter() - start)
+
+    @contextmanager
+    def helper(self, name: str) -> Iterator[None]:
+        """Time an include helper or extractor invocation.
+
+        Args:
+            name: Helper name, e.g. "include_markdown" or "extract_godoc".
+        """
+        start = time.perf_counter()
+        try:
+            yield
+        finally:
+            self._record(self.helpers, name, time.perf_counter() - start)
+
+    def total_seconds(self) -> float:
+        """Get the wall time elapsed since the profiler was created.
+
+        Returns:
+            Elapsed seconds as a float.
+        """
+        return time.perf_counter() - self._run_start
+
+    def top_pages(self, limit: int = 10) -> List[Tuple[str, float]]:
+        """Get the slowest pages in descending order.
+
+        Args:
+            limit: Maximum number of entries to return.
+
+        Returns:
+            List of (page_id, seconds) tuples.
+        """
+        ranked = sorted(self.pages.items(), key=lambda item: item[1], reverse=True)
+        return ranked[:limit]
+
+    def report(self, top_n: int = 10) -> str:
+        """Render a human-readable timing summary.
+
+        Args:
+            top_n: Number of slowest pages to include in the table.
+
+        Returns:
+            Multi-line report string.
+        """
+        lines = ["", "Profile summary", "===============", ""]
+
+        lines.append("Phases:")
+        for name, seconds in sorted(self.phases.items(), key=lambda item: item[1], reverse=True):
+            lines.append(f"  {name:<24} {seconds * 1000.0:>10.1f} ms")
+        if not self.phases:
+            lines.append("  (none recorded)")
+
+        if self.helpers:
+            lines.append("")
+            lines.append("Helpers:")
+            for name, seconds in sorted(
+                self.helpers.items(), key=lambda item: item[1], reverse=True
+            ):
+                lines.append(f"  {name:<24} {seconds * 1000.0:>10.1f} ms")
+
+        slowest = self.top_pages(top_n)
+        if slowest:
+            lines.append("")
+            lines.append(f"Top {len(slowest)} slowest pages:")
+            for page_id, seconds in slowest:
+                lines.append(f"  {page_id:<32} {seconds * 1000.0:>10.1f} ms")
+
+        lines.append("")
+        lines.append(f"Total wall time: {self.total_seconds():.2f} s")
+        return "\n".join(lines)
+
+    def to_dict(self) -> Dict[str, Any]:
+        """Export the raw timing data.
+
+        Returns:
+            Dictionary with total, per-phase, per-page and per-helper
+            timings in seconds.
+        """
+        return {
+            "total_seconds": self.total_seconds(),
+            "phases": dict(self.phases),
+            "pages": dict(self.pages),
+            "helpers": dict(self.helpers),
+        }
+
+    def save_json(self, path: Path) -> None:
+        """Write the raw timing data as JSON.
+
+        Args:
+            path: Destination file path.
+        """
+        path.parent.mkdir(parents=True, exist_ok=True)
+        path.write_text(json.dumps(self.to_dict(), indent=2, sort_keys=True), encoding="utf-8")
@@ -14,15 +14,63 @@ The parser supports:
 Copyright (c) 2025 WT Tech Jakub Brzezowski
 """
 
+import hashlib
 import json
 import logging
 import re
 import subprocess
+from bisect import bisect_left
 from pathlib import Path
 from typing import Any, Dict, List, Optional, Tuple
 
 logger = logging.getLogger(__name__)
 
+# Precompiled patterns - parse_proto_file() runs these over every proto file,
+# so they are compiled once at import time instead of per call.
+_MESSAGE_RE = re.compile(r"message\s+(\w+)\s*\{")
+_ENUM_RE = re.compile(r"enum\s+(\w+)\s*\{")
+_SERVICE_RE = re.compile(r"service\s+(\w+)\s*\{")
+_FIELD_RE = re.compile(r"(repeated|optional)?\s*(\w+)\s+(\w+)\s*=\s*(\d+)\s*;")
+_ENUM_VALUE_RE = re.compile(r"(\w+)\s*=\s*(\d+)\s*;")
+_RPC_RE = re.compile(r"rpc\s+(\w+)\s*\(\s*(\w+)\s*\)\s*returns\s*\(\s*(\w+)\s*\)\s*;")
+_PACKAGE_RE = re.compile(r"package\s+([\w.]+)\s*;")
+_SYNTAX_RE = re.compile(r'syntax\s*=\s*"([^"]+)"\s*;')
+_REF_RE = re.compile(r"@Ref\s+([\w.]+)")
+
+
+def _newline_offsets(text: str) -> List[int]:
+    """Collect the offsets of all newline characters in a text.
+
+    Built once per parsed text so that declaration positions can be mapped to
+    line numbers in O(log n) instead of re-counting the prefix for every
+    declaration, which made parsing quadratic on large schemas.
+
+    Args:
+        text: Text to index.
+
+    Returns:
+        Sorted list of newline character offsets.
+    """
+    offsets = []
+    pos = text.find("\n")
+    while pos != -1:
+        offsets.append(pos)
+        pos = text.find("\n", pos + 1)
+    return offsets
+
+
+def _line_at(offsets: List[int], pos: int) -> int:
+    """Map a character offset to its zero-based line number.
+
+    Args:
+        offsets: Newline offsets from _newline_offsets().
+        pos: Character offset within the indexed text.
+
+    Returns:
+        Zero-based line number containing the offset.
+    """
+    return bisect_left(offsets, pos)
+
 
 class ProtoDocExtractor:
     """Extract and convert Protocol Buffer documentation to RST format."""
@@ -34,6 +82,9 @@ class ProtoDocExtractor:
             proto_path: Optional path to the directory containing .proto files.
         """
         self.proto_path = proto_path
+        # Optional shared cache of parsed proto structures keyed by content
+        # hash, so documentation and diagram generation parse each file once.
+        self.parse_cache: Optional[Dict[str, Dict[str, Any]]] = None
 
     def check_protoc_available(self) -> bool:
         """Check if protoc is installed and available.
@@ -424,9 +475,9 @@ class ProtoDocExtractor:
         Returns:
             Text with @Ref converted to RST cross-reference syntax.
         """
-        # Match @Ref followed by one or more word characters (letters, digits, underscores, dots)
+        # _REF_RE matches @Ref followed by one or more word characters
+        # (letters, digits, underscores, dots).
         # This will match: @Ref User, @Ref user.v1.User, @Ref CreateUserRequest, etc.
-        pattern = r"@Ref\s+([\w.]+)"
 
         def replace_ref(match):
             """Replace @Ref with Sphinx reference directive."""
@@ -436,7 +487,7 @@ class ProtoDocExtractor:
             # We use the type name as both the label and display text
             return f":ref:`{ref_name} <proto-{ref_name}>`"
 
-        return re.sub(pattern, replace_ref, text)
+        return _REF_RE.sub(replace_ref, text)
 
     def _parse_asyncapi_keywords(self, comment: str) -> Tuple[str, Dict[str, str]]:
         """Parse AsyncAPI validation keywords from a comment.
@@ -568,8 +619,17 @@ class ProtoDocExtractor:
             content: Content of the proto file.
 
         Returns:
-            Dictionary containing parsed structure.
+            Dictionary containing parsed structure. When a parse cache is
+            attached, the returned structure is shared - treat it as
+            read-only.
         """
+        cache_key = None
+        if self.parse_cache is not None:
+            cache_key = hashlib.sha256(content.encode("utf-8")).hexdigest()
+            cached = self.parse_cache.get(cache_key)
+            if cached is not None:
+                return cached
+
         lines = content.split("\n")
         result: Dict[str, Any] = {
             "file_comment": "",
@@ -604,12 +664,12 @@ class ProtoDocExtractor:
         result["file_comment"] = self._normalize_comment("\n".join(file_comments))
 
         # Extract package
-        package_match = re.search(r"package\s+([\w.]+)\s*;", content)
+        package_match = _PACKAGE_RE.search(content)
         if package_match:
             result["package"] = package_match.group(1)
 
         # Extract syntax
-        syntax_match = re.search(r'syntax\s*=\s*"([^"]+)"\s*;', content)
+        syntax_match = _SYNTAX_RE.search(content)
         if syntax_match:
             result["syntax"] = syntax_match.group(1)
 
@@ -618,6 +678,9 @@ class ProtoDocExtractor:
         result["enums"] = self._parse_enums(content, lines)
         result["services"] = self._parse_services(content, lines)
 
+        if self.parse_cache is not None and cache_key is not None:
+            self.parse_cache[cache_key] = result
+
         return result
 
     def _parse_messages(self, content: str, lines: List[str]) -> List[Dict[str, Any]]:
@@ -631,10 +694,9 @@ class ProtoDocExtractor:
             List of parsed message dictionaries.
         """
         messages = []
-        # Pattern to match message keyword and name
-        pattern = r"message\s+(\w+)\s*\{"
+        offsets = _newline_offsets(content)
 
-        for match in re.finditer(pattern, content):
+        for match in _MESSAGE_RE.finditer(content):
             msg_name = match.group(1)
 
             # Find the matching closing brace by counting braces
@@ -653,7 +715,7 @@ class ProtoDocExtractor:
             msg_body = content[start_pos : pos - 1]
 
             # Find line number for comment extraction
-            line_idx = content[: match.start()].count("\n")
+            line_idx = _line_at(offsets, match.start())
             raw_comment = self._extract_comments_before(lines, line_idx)
             comment = self._normalize_comment(raw_comment)
             # Process cross-references in message-level comments
@@ -677,18 +739,17 @@ class ProtoDocExtractor:
             List of parsed field dictionaries.
         """
         fields = []
-        # Pattern to match field declarations
-        # Matches: [repeated|optional] type name = number;
-        pattern = r"(repeated|optional)?\s*(\w+)\s+(\w+)\s*=\s*(\d+)\s*;"
+        offsets = _newline_offsets(body)
 
-        for match in re.finditer(pattern, body):
+        # _FIELD_RE matches: [repeated|optional] type name = number;
+        for match in _FIELD_RE.finditer(body):
             label = match.group(1) or ""
             field_type = match.group(2)
             field_name = match.group(3)
             field_number = match.group(4)
 
             # Find line for comment extraction
-            line_idx = body[: match.start()].count("\n")
+            line_idx = _line_at(offsets, match.start())
 
             # If the match includes a leading newline, the actual line is one more
             if line_idx < len(body_lines) and body[match.start() : match.start() + 1] == "\n":
@@ -745,10 +806,9 @@ class ProtoDocExtractor:
             List of parsed enum dictionaries.
         """
         enums = []
-        # Pattern to match enum keyword and name
-        pattern = r"enum\s+(\w+)\s*\{"
+        offsets = _newline_offsets(content)
 
-        for match in re.finditer(pattern, content):
+        for match in _ENUM_RE.finditer(content):
             enum_name = match.group(1)
 
             # Find the matching closing brace by counting braces
@@ -767,7 +827,7 @@ class ProtoDocExtractor:
             enum_body = content[start_pos : pos - 1]
 
             # Find line number for comment extraction
-            line_idx = content[: match.start()].count("\n")
+            line_idx = _line_at(offsets, match.start())
             raw_comment = self._extract_comments_before(lines, line_idx)
             comment = self._normalize_comment(raw_comment)
             # Process cross-references in enum-level comments
@@ -791,15 +851,14 @@ class ProtoDocExtractor:
             List of parsed enum value dictionaries.
         """
         values = []
-        # Pattern to match enum value declarations
-        pattern = r"(\w+)\s*=\s*(\d+)\s*;"
+        offsets = _newline_offsets(body)
 
-        for match in re.finditer(pattern, body):
+        for match in _ENUM_VALUE_RE.finditer(body):
             value_name = match.group(1)
             value_number = match.group(2)
 
             # Find line for comment extraction
-            line_idx = body[: match.start()].count("\n")
+            line_idx = _line_at(offsets, match.start())
 
             # Extract preceding comment
             raw_comment = self._extract_comments_before(body_lines, line_idx)
@@ -829,10 +888,9 @@ class ProtoDocExtractor:
             List of parsed service dictionaries.
         """
         services = []
-        # Pattern to match service keyword and name
-        pattern = r"service\s+(\w+)\s*\{"
+        offsets = _newline_offsets(content)
 
-        for match in re.finditer(pattern, content):
+        for match in _SERVICE_RE.finditer(content):
             service_name = match.group(1)
 
             # Find the matching closing brace by counting braces
@@ -851,7 +909,7 @@ class ProtoDocExtractor:
             service_body = content[start_pos : pos - 1]
 
             # Find line number for comment extraction
-            line_idx = content[: match.start()].count("\n")
+            line_idx = _line_at(offsets, match.start())
             raw_comment = self._extract_comments_before(lines, line_idx)
             comment = self._normalize_comment(raw_comment)
             # Process cross-references in service-level comments
@@ -875,16 +933,15 @@ class ProtoDocExtractor:
             List of parsed RPC method dictionaries.
         """
         methods = []
-        # Pattern to match RPC declarations
-        pattern = r"rpc\s+(\w+)\s*\(\s*(\w+)\s*\)\s*returns\s*\(\s*(\w+)\s*\)\s*;"
+        offsets = _newline_offsets(body)
 
-        for match in re.finditer(pattern, body):
+        for match in _RPC_RE.finditer(body):
             method_name = match.group(1)
             request_type = match.group(2)
             response_type = match.group(3)
 
             # Find line for comment extraction
-            line_idx = body[: match.start()].count("\n")
+            line_idx = _line_at(offsets, match.start())
 
             # Extract preceding comment
             raw_comment = self._extract_comments_before(body_lines, line_idx)
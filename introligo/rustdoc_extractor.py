@@ -16,6 +16,10 @@ from typing import Dict, List, Optional, Tuple
 
 logger = logging.getLogger(__name__)
 
+# Chunk size for streaming scans of rustdoc JSON output. Large crates can
+# produce multi-gigabyte JSON files, so they are never loaded whole.
+_JSON_CHUNK_SIZE = 1 << 20
+
 
 class RustDocExtractor:
     """Extract and convert Rust documentation to RST format."""
@@ -129,16 +133,8 @@ class RustDocExtractor:
         Returns:
             Documentation string, or None if extraction fails.
         """
-        # Try to generate JSON documentation (requires Rust 1.78+)
-        logger.info(f"Attempting to generate rustdoc JSON for crate at {self.crate_path}")
-        json_doc = self._try_rustdoc_json(crate_name)
-
-        if json_doc:
-            logger.info("Successfully extracted documentation from rustdoc JSON")
-            return json_doc
-
-        # Prefer source parsing over HTML parsing - it produces better formatted output
-        logger.info("Rustdoc JSON not available, using direct source parsing")
+        # Prefer direct source parsing - it produces the richest output
+        # (module docs plus every public item with its doc comments)
         lib_rs = self.crate_path / "src" / "lib.rs" if self.crate_path else None
         main_rs = self.crate_path / "src" / "main.rs" if self.crate_path else None
         source_file = (
@@ -151,8 +147,17 @@ class RustDocExtractor:
             logger.info(f"Parsing source file: {source_file}")
             return self._parse_rust_source(source_file)
 
+        # No source file: try rustdoc JSON output (requires Rust 1.78+),
+        # parsed with the bounded-memory streaming scanner
+        logger.info(f"Attempting to generate rustdoc JSON for crate at {self.crate_path}")
+        json_doc = self._try_rustdoc_json(crate_name)
+
+        if json_doc:
+            logger.info("Successfully extracted documentation from rustdoc JSON")
+            return json_doc
+
         # Last resort: Try cargo doc HTML parsing (produces less formatted output)
-        logger.info("Source file not found, trying cargo doc HTML parsing")
+        logger.info("Rustdoc JSON not available, trying cargo doc HTML parsing")
         cmd = ["cargo", "doc", "--no-deps", "--message-format=json"]
         result = subprocess.run(
             cmd,
@@ -228,6 +233,12 @@ class RustDocExtractor:
     def _parse_rustdoc_json(self, json_file: Path) -> Optional[str]:
         """Parse rustdoc JSON output to extract documentation.
 
+        Rustdoc JSON for large crates can run to gigabytes, so instead of
+        json.load()-ing the whole document this scans the file in fixed-size
+        chunks and captures only the crate root item and the public item
+        paths. Peak memory stays bounded by the chunk size plus the largest
+        captured entry, regardless of crate size.
+
         Args:
             json_file: Path to the JSON file.
 
@@ -235,28 +246,237 @@ class RustDocExtractor:
             Formatted documentation as string, or None if parsing fails.
         """
         try:
-            with open(json_file, encoding="utf-8") as f:
-                data = json.load(f)
+            root_raw = self._scan_top_level_value(json_file, "root")
+            if root_raw is None:
+                logger.debug("No crate root id found in rustdoc JSON")
+                return None
+            root_id = json.loads(root_raw)
 
             doc_parts = []
 
-            # Extract crate-level documentation
-            if "index" in data and "crate_id" in data["index"]:
-                crate_id = data["index"]["crate_id"]
-                if crate_id in data["index"]["items"]:
-                    crate_item = data["index"]["items"][crate_id]
-                    if "docs" in crate_item and crate_item["docs"]:
-                        doc_parts.append(crate_item["docs"])
-                        doc_parts.append("")
-
-            # Extract items (this would need more comprehensive parsing)
-            # For now, fall back to source parsing
+            # Extract crate-level documentation from the root item
+            root_item = self._scan_index_entry(json_file, str(root_id))
+            if root_item and root_item.get("docs"):
+                processed = self._process_doc_comments(str(root_item["docs"]).split("\n"))
+                doc_parts.extend(processed)
+                doc_parts.append("")
+
+            # List public items defined in the local crate
+            public_items = self._scan_local_item_paths(json_file)
+            if public_items:
+                doc_parts.append("Public Items")
+                doc_parts.append("=" * 20)
+                doc_parts.append("")
+                for item in public_items:
+                    doc_parts.append(f"- ``{item}``")
+                doc_parts.append("")
+
+            if doc_parts:
+                return "\n".join(doc_parts)
             return None
 
         except (json.JSONDecodeError, Exception) as e:
             logger.warning(f"Could not parse rustdoc JSON: {e}")
             return None
 
+    def _scan_top_level_value(self, json_file: Path, key: str) -> Optional[str]:
+        """Find the raw JSON value of a top-level key without loading the file.
+
+        Args:
+            json_file: Path to the JSON file.
+            key: Top-level object key to look up.
+
+        Returns:
+            Raw JSON text of the value, or None if the key is absent.
+        """
+        with open(json_file, encoding="utf-8") as f:
+            for member, raw in self._iter_json_object_members(f, (), wanted={key}):
+                if member == key and raw is not None:
+                    return raw
+        return None
+
+    def _scan_index_entry(self, json_file: Path, item_id: str) -> Optional[Dict]:
+        """Extract a single item from the rustdoc JSON "index" object.
+
+        Args:
+            json_file: Path to the JSON file.
+            item_id: Key of the item within the index.
+
+        Returns:
+            Parsed item dictionary, or None if not found.
+        """
+        with open(json_file, encoding="utf-8") as f:
+            for member, raw in self._iter_json_object_members(f, ("index",), wanted={item_id}):
+                if member == item_id and raw is not None:
+                    parsed: Dict = json.loads(raw)
+                    return parsed
+        return None
+
+    def _scan_local_item_paths(self, json_file: Path) -> List[str]:
+        """Collect paths of local crate items from the rustdoc JSON "paths" object.
+
+        Entries are decoded one at a time, so memory stays bounded even when
+        the paths table is very large. All local items are collected - the
+        result holds only short path strings, not the item bodies.
+
+        Args:
+            json_file: Path to the JSON file.
+
+        Returns:
+            List of fully qualified item paths (e.g. "my_crate::foo::bar").
+        """
+        names: List[str] = []
+        with open(json_file, encoding="utf-8") as f:
+            for _, raw in self._iter_json_object_members(f, ("paths",)):
+                if raw is None:
+                    continue
+                entry = json.loads(raw)
+                if isinstance(entry, dict) and entry.get("crate_id") == 0:
+                    item_path = entry.get("path") or []
+                    if item_path:
+                        names.append("::".join(item_path))
+        return names
+
+    @staticmethod
+    def _iter_json_object_members(f, path: Tuple[str, ...], wanted: Optional[set] = None):
+        """Stream the members of a JSON object without materializing the document.
+
+        Walks the file in fixed-size chunks, tracking only container nesting
+        and the current key, and yields the members of the object addressed by
+        `path`. Values of members not in `wanted` are skipped without
+        buffering, so peak memory is bounded by the chunk size plus the
+        largest captured member.
+
+        Args:
+            f: Open text-mode file positioned at the start of the document.
+            path: Tuple of object keys addressing the object to iterate
+                (empty tuple for the top-level object).
+            wanted: Optional set of member keys to capture; None captures all.
+
+        Yields:
+            Tuples of (member_key, raw_json_value). Skipped members yield
+            (member_key, None).
+        """
+        target = tuple(path)
+        stack: List[str] = []  # open containers: '{' or '['
+        open_keys: List[Optional[str]] = []  # key each container was opened under
+        in_string = False
+        escape = False
+        after_colon = False
+        key_buf: Optional[List[str]] = None  # collecting a member key string
+        member_key: Optional[str] = None
+        capture: Optional[List[str]] = None  # raw text of a captured value
+        capture_key: Optional[str] = None
+        capture_depth = 0
+
+        def at_target() -> bool:
+            return bool(stack) and stack[-1] == "{" and tuple(open_keys[1:]) == target
+
+        while True:
+            chunk = f.read(_JSON_CHUNK_SIZE)
+            if not chunk:
+                return
+            i = 0
+            n = len(chunk)
+            while i < n:
+                ch = chunk[i]
+
+                if in_string:
+                    if capture is not None:
+                        capture.append(ch)
+                    if escape:
+                        escape = False
+                        if key_buf is not None:
+                            key_buf.append(ch)
+                    elif ch == "\\":
+                        escape = True
+                        if key_buf is not None:
+                            key_buf.append(ch)
+                    elif ch == '"':
+                        in_string = False
+                        if key_buf is not None:
+                            member_key = json.loads('"' + "".join(key_buf) + '"')
+                            key_buf = None
+                    else:
+                        if key_buf is not None:
+                            key_buf.append(ch)
+                        elif capture is None:
+                            # Fast-forward over uncaptured string content
+                            j_quote = chunk.find('"', i)
+                            j_escape = chunk.find("\\", i)
+                            candidates = [j for j in (j_quote, j_escape) if j >= 0]
+                            if not candidates:
+                                i = n
+                                continue
+                            i = min(candidates)
+                            continue
+                    i += 1
+                    continue
+
+                if ch == '"':
+                    in_string = True
+                    escape = False
+                    if capture is not None:
+                        capture.append(ch)
+                        after_colon = False
+                    elif stack and stack[-1] == "{" and not after_colon:
+                        key_buf = []
+                    else:
+                        after_colon = False
+                elif ch == ":":
+                    after_colon = True
+                    if capture is not None:
+                        capture.append(ch)
+                    elif member_key is not None and at_target():
+                        if wanted is None or member_key in wanted:
+                            capture = []
+                            capture_key = member_key
+                            capture_depth = len(stack)
+                        else:
+                            yield (member_key, None)
+                elif ch in "{[":
+                    if capture is not None:
+                        capture.append(ch)
+                    in_object_value = bool(stack) and stack[-1] == "{" and after_colon
+                    opened_under = member_key if in_object_value else None
+                    stack.append(ch)
+                    open_keys.append(opened_under)
+                    after_colon = False
+                    member_key = None
+                elif ch in "}]":
+                    closing_target = ch == "}" and at_target()
+                    if capture is not None and not (capture and capture[0] in "{["):
+                        # Scalar capture terminated by the enclosing close
+                        yield (capture_key, "".join(capture).strip())
+                        capture = None
+                        stack.pop()
+                        open_keys.pop()
+                    else:
+                        if capture is not None:
+                            capture.append(ch)
+                        stack.pop()
+                        open_keys.pop()
+                        if capture is not None and len(stack) == capture_depth:
+                            yield (capture_key, "".join(capture))
+                            capture = None
+                    if closing_target:
+                        return
+                elif ch == ",":
+                    if capture is not None:
+                        if capture and capture[0] in "{[":
+                            capture.append(ch)
+                        elif len(stack) == capture_depth:
+                            yield (capture_key, "".join(capture).strip())
+                            capture = None
+                        else:
+                            capture.append(ch)
+                else:
+                    if capture is not None and (capture or not ch.isspace()):
+                        capture.append(ch)
+                    if after_colon and not ch.isspace():
+                        after_colon = False
+                i += 1
+
     def _extract_from_cargo_doc(self, crate_name: Optional[str] = None) -> Optional[str]:
         """Extract documentation from cargo doc generated files.
 
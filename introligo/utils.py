@@ -6,11 +6,17 @@ Copyright (c) 2025 WT Tech Jakub Brzezowski
 
 import re
 import unicodedata
+from functools import lru_cache
 
 
+@lru_cache(maxsize=4096)
 def slugify(text: str) -> str:
     """Convert text to ASCII-safe filesystem-compatible slug.
 
+    Results are memoized: the same titles are slugified repeatedly while
+    building page trees and toctree paths, so repeated calls become
+    dictionary lookups.
+
     Args:
         text: The text to convert to a slug.
 
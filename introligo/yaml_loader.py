@@ -5,8 +5,9 @@ Copyright (c) 2025 WT Tech Jakub Brzezowski
 """
 
 import logging
+from copy import deepcopy
 from pathlib import Path
-from typing import Any, cast
+from typing import Any, Dict, List, Tuple, cast
 
 import yaml
 
@@ -14,6 +15,31 @@ from .errors import IntroligoError
 
 logger = logging.getLogger(__name__)
 
+# Per-run cache of parsed include files keyed by resolved path and mtime, so
+# shared fragments included from many configs are parsed once. Cached entries
+# are deep-copied on reuse, keeping callers free to mutate their copy.
+_include_cache: Dict[Tuple[str, int], Any] = {}
+
+# Stack of include files currently being loaded, used to fail fast on cycles.
+_include_stack: List[str] = []
+
+
+def clear_include_cache() -> None:
+    """Clear the per-run include cache (e.g. between watch-mode rebuilds)."""
+    _include_cache.clear()
+
+
+def get_cached_include_paths() -> List[Path]:
+    """Get the paths of all include files loaded so far in this process.
+
+    Used by watch mode to build the set of files whose changes should
+    trigger a rebuild.
+
+    Returns:
+        List of resolved include file paths.
+    """
+    return [Path(key_path) for key_path, _ in _include_cache]
+
 
 class IncludeLoader(yaml.SafeLoader):
     """YAML loader with support for !include directive.
@@ -44,6 +70,48 @@ class IncludeLoader(yaml.SafeLoader):
         super().__init__(stream)
 
 
+if getattr(yaml, "__with_libyaml__", False):
+
+    class CIncludeLoader(yaml.CSafeLoader):
+        """C-accelerated YAML loader with support for !include directive.
+
+        Behaves exactly like IncludeLoader but parses with libyaml's
+        CSafeLoader, which is significantly faster on large composed
+        configurations. Only defined when PyYAML was built with libyaml.
+
+        Inherits from:
+            yaml.CSafeLoader: libyaml-backed safe loader from PyYAML.
+        """
+
+        def __init__(self, stream):
+            """Initialize the loader with file path tracking.
+
+            Args:
+                stream: YAML input stream, typically a file object.
+            """
+            self.root_dir = Path.cwd()
+
+            # Track the directory of the current file for relative includes
+            if hasattr(stream, "name"):
+                self._current_file = Path(stream.name).resolve()
+                self.root_dir = self._current_file.parent
+
+            super().__init__(stream)
+
+else:
+    CIncludeLoader = None  # type: ignore[assignment,misc]
+
+
+def get_include_loader() -> type:
+    """Get the fastest available loader supporting the !include directive.
+
+    Returns:
+        CIncludeLoader when PyYAML was built with libyaml, IncludeLoader
+        otherwise.
+    """
+    return CIncludeLoader if CIncludeLoader is not None else IncludeLoader
+
+
 def include_constructor(loader: IncludeLoader, node: Any) -> Any:
     """Construct included YAML content.
 
@@ -69,18 +137,41 @@ def include_constructor(loader: IncludeLoader, node: Any) -> Any:
     if not full_path.exists():
         raise IntroligoError(f"Include file not found: {full_path}")
 
+    key_path = str(full_path)
+    if key_path in _include_stack:
+        chain = " -> ".join([*_include_stack[_include_stack.index(key_path) :], key_path])
+        raise IntroligoError(f"Circular include detected: {chain}")
+
+    try:
+        mtime_ns = full_path.stat().st_mtime_ns
+    except OSError:
+        mtime_ns = -1
+    cache_key = (key_path, mtime_ns)
+    if cache_key in _include_cache:
+        logger.debug(f"  Including (cached): {full_path}")
+        return deepcopy(_include_cache[cache_key])
+
     logger.debug(f"  Including: {full_path}")
 
-    # Load the included file with the same loader to support nested includes
+    # Load the included file with the same loader class to support nested
+    # includes (and keep the C-accelerated variant once selected)
+    _include_stack.append(key_path)
     try:
         with open(full_path, encoding="utf-8") as f:
-            # Using custom IncludeLoader for YAML file inclusion feature
-            return yaml.load(f, Loader=IncludeLoader)  # nosec B506
+            # Using custom include loaders for YAML file inclusion feature
+            content = yaml.load(f, Loader=type(loader))  # nosec B506
     except yaml.YAMLError as e:
         raise IntroligoError(f"Invalid YAML in included file {full_path}: {e}") from e
     except Exception as e:
         raise IntroligoError(f"Error loading included file {full_path}: {e}") from e
+    finally:
+        _include_stack.pop()
+
+    _include_cache[cache_key] = deepcopy(content)
+    return content
 
 
-# Register the include constructor
+# Register the include constructor on both loader variants
 yaml.add_constructor("!include", include_constructor, IncludeLoader)
+if CIncludeLoader is not None:
+    yaml.add_constructor("!include", include_constructor, CIncludeLoader)
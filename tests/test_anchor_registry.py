@@ -0,0 +1,135 @@
+"""Tests for the generation-wide slug/anchor registry."""
+
+from pathlib import Path
+
+from introligo import AnchorRegistry, IntroligoGenerator
+from introligo.utils import slugify
+
+
+class TestAnchorRegistry:
+    """Test cases for AnchorRegistry."""
+
+    def test_register_and_resolve_page(self):
+        """Test registering a page and resolving its slug."""
+        registry = AnchorRegistry()
+        assert registry.register_page("api", "api_reference", Path("generated/api_reference.rst"))
+
+        assert registry.resolve_page("api_reference") == "api"
+        assert registry.get_output_file("api") == Path("generated/api_reference.rst")
+        assert len(registry) == 1
+
+    def test_duplicate_slug_detection(self):
+        """Test that a second page with the same slug is flagged."""
+        registry = AnchorRegistry()
+        registry.register_page("one", "shared", Path("a.rst"))
+        assert not registry.register_page("two", "shared", Path("b.rst"))
+
+        assert registry.duplicate_slugs == ["shared"]
+        # First registration wins for resolution
+        assert registry.resolve_page("shared") == "one"
+
+    def test_register_and_resolve_heading(self):
+        """Test heading registration returns a stable RST label."""
+        registry = AnchorRegistry()
+        label = registry.register_heading("docs/guide.md", "Getting Started!")
+
+        assert label == "getting-started"
+        assert registry.resolve_heading("docs/guide.md", "Getting Started!") == label
+        # Anchor-style slugs resolve to the same label as the title
+        assert registry.resolve_heading("docs/guide.md", "getting-started") == label
+        assert registry.resolve_heading("docs/other.md", "Getting Started!") is None
+
+    def test_unknown_lookups_return_none(self):
+        """Test that unregistered slugs and pages resolve to None."""
+        registry = AnchorRegistry()
+        assert registry.resolve_page("missing") is None
+        assert registry.get_output_file("missing") is None
+
+
+class TestConverterRegistryIntegration:
+    """Test cases for registry use in markdown link conversion."""
+
+    def test_headings_registered_during_conversion(self):
+        """Test that converting markdown registers its headings."""
+        from introligo.markdown_converter import convert_markdown_to_rst
+
+        registry = AnchorRegistry()
+        convert_markdown_to_rst(
+            "# Guide\n\n## Getting Started\n\nText.",
+            registry=registry,
+            source="docs/guide.md",
+        )
+
+        assert registry.resolve_heading("docs/guide.md", "Getting Started") == "getting-started"
+
+    def test_unknown_anchor_link_warns(self, caplog):
+        """Test that an anchor matching no heading produces a warning."""
+        import logging
+
+        from introligo.markdown_converter import convert_markdown_to_rst
+
+        registry = AnchorRegistry()
+        markdown = "# Guide\n\nSee [intro](#introduction) and [guide](#guide).\n"
+        with caplog.at_level(logging.WARNING, logger="introligo.markdown_converter"):
+            convert_markdown_to_rst(markdown, registry=registry, source="docs/guide.md")
+
+        assert "#introduction" in caplog.text
+        assert "#guide" not in caplog.text
+
+    def test_forward_anchor_reference_validates(self, caplog):
+        """Test that a link before its target heading does not warn."""
+        import logging
+
+        from introligo.markdown_converter import convert_markdown_to_rst
+
+        registry = AnchorRegistry()
+        markdown = "See [usage](#usage) below.\n\n# Usage\n\nText.\n"
+        with caplog.at_level(logging.WARNING, logger="introligo.markdown_converter"):
+            convert_markdown_to_rst(markdown, registry=registry, source="docs/guide.md")
+
+        assert "#usage" not in caplog.text
+
+
+class TestGeneratorRegistryIntegration:
+    """Test cases for registry population in build_page_tree()."""
+
+    def test_registry_built_with_page_tree(self, sample_yaml_config: Path, temp_dir: Path):
+        """Test that building the page tree registers every page."""
+        generator = IntroligoGenerator(sample_yaml_config, temp_dir / "docs")
+        generator.load_config()
+        generator.build_page_tree()
+
+        registry = generator.anchor_registry
+        assert len(registry) == 3
+        assert registry.resolve_page(slugify("My Module")) == "my_module"
+        assert registry.get_output_file("child_module") is not None
+        assert not registry.duplicate_slugs
+
+    def test_duplicate_titles_flagged_in_tree(self, temp_dir: Path):
+        """Test that two pages with identical titles are reported."""
+        config_file = temp_dir / "config.yaml"
+        config_file.write_text(
+            """
+modules:
+  first:
+    title: "Same Title"
+  second:
+    title: "Same Title"
+""",
+            encoding="utf-8",
+        )
+        generator = IntroligoGenerator(config_file, temp_dir / "docs")
+        generator.load_config()
+        generator.build_page_tree()
+
+        assert generator.anchor_registry.duplicate_slugs == [slugify("Same Title")]
+
+
+def test_slugify_is_memoized():
+    """Test that repeated slugify calls hit the cache."""
+    slugify.cache_clear()
+    slugify("Some Title")
+    slugify("Some Title")
+
+    info = slugify.cache_info()
+    assert info.hits >= 1
@@ -0,0 +1,121 @@
+"""Tests for lazy imports and the extension auto-configuration cache."""
+
+import subprocess
+import sys
+from pathlib import Path
+
+from introligo import IntroligoGenerator
+from introligo.generator import IntroligoGenerator as GeneratorClass
+from introligo.generator import is_package_available
+
+
+def _make_sphinx_config(temp_dir: Path, module_field: str = 'module: "json"') -> Path:
+    """Create a config with a sphinx section triggering auto-configuration."""
+    config_file = temp_dir / "config.yaml"
+    config_file.write_text(
+        f"""
+sphinx:
+  project: "Test"
+  extensions: []
+modules:
+  mod:
+    title: "Mod"
+    {module_field}
+""",
+        encoding="utf-8",
+    )
+    return config_file
+
+
+class TestAutoconfigCache:
+    """Test cases for the persisted extension auto-configuration."""
+
+    def test_second_run_skips_detection(self, temp_dir: Path, monkeypatch):
+        """Test that an unchanged config reuses the cached result."""
+        config_file = _make_sphinx_config(temp_dir)
+
+        calls = []
+        original = GeneratorClass.detect_project_languages
+
+        def counting(self):
+            calls.append(1)
+            return original(self)
+
+        monkeypatch.setattr(GeneratorClass, "detect_project_languages", counting)
+
+        first = IntroligoGenerator(config_file, temp_dir / "docs")
+        first.write_files(first.generate_all())
+        assert len(calls) == 1
+        assert first.get_autoconfig_cache_path().exists()
+
+        second = IntroligoGenerator(config_file, temp_dir / "docs")
+        second.load_config()
+        second.load_sphinx_config()
+        assert len(calls) == 1
+        assert second.sphinx_config["extensions"] == first.sphinx_config["extensions"]
+
+    def test_config_change_invalidates_cache(self, temp_dir: Path, monkeypatch):
+        """Test that editing module configs re-runs detection."""
+        config_file = _make_sphinx_config(temp_dir)
+
+        calls = []
+        original = GeneratorClass.detect_project_languages
+
+        def counting(self):
+            calls.append(1)
+            return original(self)
+
+        monkeypatch.setattr(GeneratorClass, "detect_project_languages", counting)
+
+        first = IntroligoGenerator(config_file, temp_dir / "docs")
+        first.write_files(first.generate_all())
+
+        _make_sphinx_config(temp_dir, module_field="language: go")
+        second = IntroligoGenerator(config_file, temp_dir / "docs")
+        second.load_config()
+        second.load_sphinx_config()
+        assert len(calls) == 2
+
+    def test_dry_run_does_not_write_cache(self, temp_dir: Path):
+        """Test that dry runs never create the cache file."""
+        config_file = _make_sphinx_config(temp_dir)
+        generator = IntroligoGenerator(config_file, temp_dir / "docs", dry_run=True)
+        generator.load_config()
+        generator.load_sphinx_config()
+        assert not generator.get_autoconfig_cache_path().exists()
+
+
+class TestPackageAvailability:
+    """Test cases for the memoized package probe."""
+
+    def test_available_and_missing_packages(self):
+        """Test that probe results reflect importability."""
+        assert is_package_available("json") is True
+        assert is_package_available("definitely_not_installed_pkg") is False
+
+    def test_probe_is_memoized(self):
+        """Test that repeated probes do not re-import."""
+        is_package_available.cache_clear()
+        is_package_available("json")
+        is_package_available("json")
+        assert is_package_available.cache_info().hits >= 1
+
+
+class TestLazyImports:
+    """Test that importing the package stays lightweight."""
+
+    def test_import_does_not_load_heavy_modules(self):
+        """Test that jinja2 and extractors load only on demand."""
+        code = (
+            "import sys; import introligo; "
+            "assert 'jinja2' not in sys.modules, 'jinja2 imported eagerly'; "
+            "assert 'introligo.godoc_extractor' not in sys.modules; "
+            "assert 'introligo.rustdoc_extractor' not in sys.modules"
+        )
+        result = subprocess.run(
+            [sys.executable, "-c", code],
+            capture_output=True,
+            text=True,
+            timeout=60,
+        )
+        assert result.returncode == 0, result.stderr
@@ -0,0 +1,112 @@
+"""Tests for the concurrent language extractor prefetch stage."""
+
+from pathlib import Path
+
+from introligo import IntroligoGenerator
+
+
+def _make_config(temp_dir: Path) -> Path:
+    """Create a config with several pages that use manual extractor content."""
+    config_file = temp_dir / "config.yaml"
+    config_file.write_text(
+        """
+modules:
+  gomod:
+    title: "Go Module"
+    language: go
+    godoc_package: "example.com/pkg"
+    godoc_manual_content: "GO DOC BODY"
+  javamod:
+    title: "Java Module"
+    language: java
+    java_manual_content: "JAVA DOC BODY"
+  rustmod:
+    title: "Rust Module"
+    language: rust
+    rustdoc_manual_content: "RUST DOC BODY"
+  plain:
+    title: "Plain Page"
+    description: "No extraction here"
+""",
+        encoding="utf-8",
+    )
+    return config_file
+
+
+class TestExtractionPrefetch:
+    """Test cases for prefetch_extracted_content()."""
+
+    def test_prefetch_fills_cache_for_extraction_pages(self, temp_dir: Path):
+        """Test that only pages needing extraction are prefetched."""
+        generator = IntroligoGenerator(_make_config(temp_dir), temp_dir / "docs")
+        generator.load_config()
+        generator.build_page_tree()
+
+        generator.prefetch_extracted_content(generator._collect_nodes(generator.page_tree))
+
+        assert sorted(generator._extraction_cache.keys()) == ["gomod", "javamod", "rustmod"]
+        assert generator._extraction_cache["gomod"]["godoc"] == "GO DOC BODY"
+        assert generator._extraction_cache["javamod"]["javadoc"] == "JAVA DOC BODY"
+        assert generator._extraction_cache["rustmod"]["rustdoc"] == "RUST DOC BODY"
+
+    def test_render_reuses_prefetched_results(self, temp_dir: Path, monkeypatch):
+        """Test that generate_all() does not re-run extraction after prefetch."""
+        generator = IntroligoGenerator(_make_config(temp_dir), temp_dir / "docs")
+
+        calls = []
+        original = IntroligoGenerator._extract_language_content
+
+        def counting(self, node):
+            calls.append(node.page_id)
+            return original(self, node)
+
+        monkeypatch.setattr(IntroligoGenerator, "_extract_language_content", counting)
+        files = generator.generate_all()
+
+        # One prefetch call per extraction page, none during rendering
+        assert sorted(calls) == ["gomod", "javamod", "rustmod"]
+        joined = "".join(content for content, _ in files.values())
+        assert "GO DOC BODY" in joined
+        assert "JAVA DOC BODY" in joined
+        assert "RUST DOC BODY" in joined
+
+    def test_single_extraction_page_skips_prefetch(self, temp_dir: Path):
+        """Test that the thread pool is not spun up for a single page."""
+        config_file = temp_dir / "config.yaml"
+        config_file.write_text(
+            """
+modules:
+  gomod:
+    title: "Go Module"
+    language: go
+    godoc_package: "example.com/pkg"
+    godoc_manual_content: "GO DOC BODY"
+""",
+            encoding="utf-8",
+        )
+        generator = IntroligoGenerator(config_file, temp_dir / "docs")
+        generator.load_config()
+        generator.build_page_tree()
+
+        generator.prefetch_extracted_content(generator._collect_nodes(generator.page_tree))
+
+        assert generator._extraction_cache == {}
+
+
+class TestNeedsExtraction:
+    """Test cases for _needs_extraction()."""
+
+    def test_go_requires_package(self):
+        """Test that Go pages without a package are not extraction jobs."""
+        assert not IntroligoGenerator._needs_extraction({"language": "go"})
+        assert IntroligoGenerator._needs_extraction(
+            {"language": "go", "godoc_package": "example.com/pkg"}
+        )
+
+    def test_other_languages(self):
+        """Test extraction detection for the remaining languages."""
+        assert IntroligoGenerator._needs_extraction({"language": "java"})
+        assert IntroligoGenerator._needs_extraction({"language": "rust"})
+        assert IntroligoGenerator._needs_extraction({"language": "protobuf"})
+        assert not IntroligoGenerator._needs_extraction({"language": "python"})
+        assert not IntroligoGenerator._needs_extraction({})
@@ -2315,3 +2315,125 @@ modules:
         # Should keep original directive when extensions available (lines 1343-1352)
         assert ".. uml::" in content
         assert "@startuml" in content
+
+
+class TestIncludeFileCache:
+    """Test the generation-scoped cache for included content files."""
+
+    def test_repeated_markdown_include_converts_once(self, temp_dir: Path, monkeypatch):
+        """Test that the same markdown file is converted only once per run."""
+        import introligo.generator as generator_module
+
+        config_file = temp_dir / "config.yaml"
+        config_file.write_text("modules:\n  test:\n    title: Test\n", encoding="utf-8")
+        md_file = temp_dir / "shared.md"
+        md_file.write_text("# Shared\n\nBody text.", encoding="utf-8")
+
+        calls = []
+        original = generator_module.convert_markdown_to_rst
+
+        def counting(content, *args, **kwargs):
+            calls.append(1)
+            return original(content, *args, **kwargs)
+
+        monkeypatch.setattr(generator_module, "convert_markdown_to_rst", counting)
+
+        generator = IntroligoGenerator(config_file, temp_dir / "output")
+        first = generator.include_markdown_file("shared.md")
+        second = generator.include_markdown_file("shared.md")
+
+        assert len(calls) == 1
+        assert first == second
+
+    def test_edited_file_is_reconverted(self, temp_dir: Path):
+        """Test that a changed mtime invalidates the cached conversion."""
+        config_file = temp_dir / "config.yaml"
+        config_file.write_text("modules:\n  test:\n    title: Test\n", encoding="utf-8")
+        rst_file = temp_dir / "shared.rst"
+        rst_file.write_text("Original body", encoding="utf-8")
+
+        generator = IntroligoGenerator(config_file, temp_dir / "output")
+        assert "Original body" in generator.include_rst_file("shared.rst")
+
+        rst_file.write_text("Updated body", encoding="utf-8")
+        assert "Updated body" in generator.include_rst_file("shared.rst")
+
+    def test_txt_include_reads_once(self, temp_dir: Path, monkeypatch):
+        """Test that repeated text includes reuse the cached literal block."""
+        config_file = temp_dir / "config.yaml"
+        config_file.write_text("modules:\n  test:\n    title: Test\n", encoding="utf-8")
+        txt_file = temp_dir / "notes.txt"
+        txt_file.write_text("line one\nline two", encoding="utf-8")
+
+        reads = []
+        original = Path.read_text
+
+        def counting(self, *args, **kwargs):
+            if self.suffix == ".txt":
+                reads.append(1)
+            return original(self, *args, **kwargs)
+
+        monkeypatch.setattr(Path, "read_text", counting)
+
+        generator = IntroligoGenerator(config_file, temp_dir / "output")
+        first = generator.include_txt_file("notes.txt")
+        second = generator.include_txt_file("notes.txt")
+
+        assert len(reads) == 1
+        assert first == second
+        assert "   line one" in first
+
+
+class TestDifferentialWrites:
+    """Test that unchanged files are not rewritten."""
+
+    def test_unchanged_files_keep_mtime(self, sample_yaml_config: Path, temp_dir: Path):
+        """Test that a rerun with identical output leaves mtimes untouched."""
+        import os
+
+        output_dir = temp_dir / "output"
+        generator = IntroligoGenerator(sample_yaml_config, output_dir)
+        generator.write_files(generator.generate_all())
+
+        rst_files = sorted(output_dir.rglob("*.rst"))
+        assert rst_files
+        before = {p: p.stat().st_mtime_ns for p in rst_files}
+
+        # Push mtimes into the past so an unconditional rewrite would be visible
+        for p in rst_files:
+            stat = p.stat()
+            os.utime(p, ns=(stat.st_atime_ns, stat.st_mtime_ns - 10_000_000_000))
+        before = {p: p.stat().st_mtime_ns for p in rst_files}
+
+        second = IntroligoGenerator(sample_yaml_config, output_dir)
+        second.write_files(second.generate_all())
+
+        after = {p: p.stat().st_mtime_ns for p in rst_files}
+        assert after == before
+
+    def test_changed_file_is_rewritten(self, sample_yaml_config: Path, temp_dir: Path):
+        """Test that stale on-disk content is still replaced."""
+        output_dir = temp_dir / "output"
+        generator = IntroligoGenerator(sample_yaml_config, output_dir)
+        generated_files = generator.generate_all()
+        generator.write_files(generated_files)
+
+        target = next(iter(generated_files.values()))[1]
+        target.write_text("stale content", encoding="utf-8")
+
+        second = IntroligoGenerator(sample_yaml_config, output_dir)
+        second.write_files(second.generate_all())
+
+        assert target.read_text(encoding="utf-8") != "stale content"
+
+    def test_write_summary_logged(self, sample_yaml_config: Path, temp_dir: Path, caplog):
+        """Test that the written/skipped summary is reported."""
+        import logging
+
+        output_dir = temp_dir / "output"
+        generator = IntroligoGenerator(sample_yaml_config, output_dir)
+
+        with caplog.at_level(logging.INFO, logger="introligo.generator"):
+            generator.write_files(generator.generate_all())
+
+        assert any("skipped" in message for message in caplog.messages)
@@ -330,3 +330,51 @@ func Second() string
         assert result.count(".. code-block:: go") == 2
         assert "func First() int" in result
         assert "func Second() string" in result
+
+
+class TestBatchedExtraction:
+    """Test cases for extract_packages_parallel() and probe memoization."""
+
+    @patch("introligo.godoc_extractor.subprocess.run")
+    def test_toolchain_probed_once_per_batch(self, mock_run):
+        """Test that one batch spawns a single `go version` probe."""
+        mock_run.return_value = MagicMock(returncode=0, stdout="package p\n\nDocs.", stderr="")
+
+        extractor = GoDocExtractor()
+        results = extractor.extract_packages_parallel(["pkg1", "pkg2", "pkg3"])
+
+        probes = [c for c in mock_run.call_args_list if c.args[0][:2] == ["go", "version"]]
+        assert len(probes) == 1
+        assert [name for name, _, _ in results] == ["pkg1", "pkg2", "pkg3"]
+        assert all(success for _, success, _ in results)
+
+    @patch("introligo.godoc_extractor.subprocess.run")
+    def test_duplicate_package_served_from_memory(self, mock_run):
+        """Test that repeated packages reuse the in-memory go doc output."""
+        mock_run.return_value = MagicMock(returncode=0, stdout="package p\n\nDocs.", stderr="")
+
+        extractor = GoDocExtractor()
+        extractor.extract_and_convert("example.com/pkg")
+        extractor.extract_and_convert("example.com/pkg")
+
+        doc_calls = [c for c in mock_run.call_args_list if c.args[0][:2] == ["go", "doc"]]
+        assert len(doc_calls) == 1
+
+    @patch("introligo.godoc_extractor.subprocess.run")
+    def test_parallel_matches_serial(self, mock_run):
+        """Test that the parallel batch returns the serial results in order."""
+        mock_run.return_value = MagicMock(returncode=0, stdout="package p\n\nDocs.", stderr="")
+
+        serial = GoDocExtractor().extract_multiple_packages(["p1", "p2"])
+        parallel = GoDocExtractor().extract_packages_parallel(["p1", "p2"])
+
+        assert parallel == serial
+
+    @patch("introligo.godoc_extractor.subprocess.run")
+    def test_single_package_uses_serial_path(self, mock_run):
+        """Test that one package is handled without spinning up a pool."""
+        mock_run.return_value = MagicMock(returncode=0, stdout="package p\n\nDocs.", stderr="")
+
+        results = GoDocExtractor().extract_packages_parallel(["only"])
+        assert len(results) == 1
+        assert results[0][1] is True
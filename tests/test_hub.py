@@ -1,5 +1,6 @@
 """Tests for documentation hub functionality."""
 
+import os
 from pathlib import Path
 from textwrap import dedent
 
@@ -897,3 +898,71 @@ def test_hub_generate_modules_multiple_docs_same_category(tmp_path):
     assert len(api_children) == 2
     # Both should have the hub_api as parent
     assert all(modules[child].get("parent") == "hub_api" for child in api_children)
+
+
+def test_hub_discovery_cache_round_trip(tmp_path):
+    """Test that discovery persists a cache and serves warm runs from it."""
+    (tmp_path / "docs").mkdir()
+    (tmp_path / "docs" / "guide.md").write_text("# Guide\ntutorial content")
+
+    config_file = tmp_path / "config.yaml"
+    config = {
+        "discovery": {
+            "enabled": True,
+            "auto_include": {"markdown_docs": "docs/**/*.md"},
+        },
+    }
+
+    cold = DocumentationHub(config_file, config)
+    cold_docs = cold.discover_documentation()
+    assert cold.get_discovery_cache_path().exists()
+
+    warm = DocumentationHub(config_file, config)
+    reads = []
+    original_probe = warm._read_probe
+    warm._read_probe = lambda path: (reads.append(path), original_probe(path))[1]
+    warm_docs = warm.discover_documentation()
+
+    assert not reads
+    assert [doc["title"] for doc in warm_docs] == [doc["title"] for doc in cold_docs]
+
+
+def test_hub_discovery_cache_invalidated_on_change(tmp_path):
+    """Test that editing a file refreshes its cached title."""
+    (tmp_path / "docs").mkdir()
+    guide = tmp_path / "docs" / "guide.md"
+    guide.write_text("# Old Title")
+
+    config_file = tmp_path / "config.yaml"
+    config = {
+        "discovery": {
+            "enabled": True,
+            "auto_include": {"markdown_docs": "docs/**/*.md"},
+        },
+    }
+
+    DocumentationHub(config_file, config).discover_documentation()
+    os.utime(guide, (0, 0))
+    guide.write_text("# New Title")
+
+    discovered = DocumentationHub(config_file, config).discover_documentation()
+    assert discovered[0]["title"] == "New Title"
+
+
+def test_hub_discovery_cache_can_be_disabled(tmp_path):
+    """Test that cache: false skips writing the cache file."""
+    (tmp_path / "README.md").write_text("# Readme")
+
+    config_file = tmp_path / "config.yaml"
+    config = {
+        "discovery": {
+            "enabled": True,
+            "cache": False,
+            "auto_include": {"readme": True},
+        },
+    }
+
+    hub = DocumentationHub(config_file, config)
+    hub.discover_documentation()
+
+    assert not hub.get_discovery_cache_path().exists()
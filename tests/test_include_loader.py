@@ -156,3 +156,150 @@ class TestIncludeLoader:
         finally:
             # Restore permissions for cleanup
             included.chmod(0o644)
+
+
+class TestIncludeCache:
+    """Test cases for the per-run include cache and cycle detection."""
+
+    def _load(self, path: Path):
+        """Load a YAML file with the IncludeLoader."""
+        with open(path, encoding="utf-8") as f:
+            return yaml.load(f, Loader=IncludeLoader)
+
+    def test_unchanged_include_served_from_cache(self, temp_dir: Path):
+        """Test that an unchanged included file is not re-parsed."""
+        import os
+
+        from introligo.yaml_loader import clear_include_cache
+
+        clear_include_cache()
+        included = temp_dir / "shared.yaml"
+        included.write_text("value: original", encoding="utf-8")
+        main = temp_dir / "main.yaml"
+        main.write_text("data: !include shared.yaml", encoding="utf-8")
+
+        first = self._load(main)
+        assert first["data"]["value"] == "original"
+
+        # Rewrite the content but restore the original mtime: the cache key
+        # is unchanged, so the stale-but-cached structure must be returned
+        stat = included.stat()
+        included.write_text("value: rewritten", encoding="utf-8")
+        os.utime(included, ns=(stat.st_atime_ns, stat.st_mtime_ns))
+
+        second = self._load(main)
+        assert second["data"]["value"] == "original"
+
+    def test_mtime_change_invalidates_cache(self, temp_dir: Path):
+        """Test that editing an included file triggers a re-parse."""
+        from introligo.yaml_loader import clear_include_cache
+
+        clear_include_cache()
+        included = temp_dir / "shared.yaml"
+        included.write_text("value: original", encoding="utf-8")
+        main = temp_dir / "main.yaml"
+        main.write_text("data: !include shared.yaml", encoding="utf-8")
+
+        assert self._load(main)["data"]["value"] == "original"
+
+        included.write_text("value: updated", encoding="utf-8")
+        assert self._load(main)["data"]["value"] == "updated"
+
+    def test_cached_structure_is_not_shared(self, temp_dir: Path):
+        """Test that mutating a loaded include does not poison the cache."""
+        from introligo.yaml_loader import clear_include_cache
+
+        clear_include_cache()
+        included = temp_dir / "shared.yaml"
+        included.write_text("items:\n  - one", encoding="utf-8")
+        main = temp_dir / "main.yaml"
+        main.write_text("data: !include shared.yaml", encoding="utf-8")
+
+        first = self._load(main)
+        first["data"]["items"].append("two")
+
+        second = self._load(main)
+        assert second["data"]["items"] == ["one"]
+
+    def test_self_include_raises(self, temp_dir: Path):
+        """Test that a file including itself fails fast."""
+        from introligo.yaml_loader import clear_include_cache
+
+        clear_include_cache()
+        looping = temp_dir / "loop.yaml"
+        looping.write_text("self: !include loop.yaml", encoding="utf-8")
+        main = temp_dir / "main.yaml"
+        main.write_text("data: !include loop.yaml", encoding="utf-8")
+
+        with pytest.raises(IntroligoError) as exc_info:
+            self._load(main)
+
+        assert "Circular include detected" in str(exc_info.value)
+
+    def test_mutual_include_cycle_raises(self, temp_dir: Path):
+        """Test that a two-file include cycle reports the chain."""
+        from introligo.yaml_loader import clear_include_cache
+
+        clear_include_cache()
+        (temp_dir / "a.yaml").write_text("b: !include b.yaml", encoding="utf-8")
+        (temp_dir / "b.yaml").write_text("a: !include a.yaml", encoding="utf-8")
+        main = temp_dir / "main.yaml"
+        main.write_text("data: !include a.yaml", encoding="utf-8")
+
+        with pytest.raises(IntroligoError) as exc_info:
+            self._load(main)
+
+        message = str(exc_info.value)
+        assert "Circular include detected" in message
+        assert "a.yaml" in message and "b.yaml" in message
+
+
+class TestCIncludeLoader:
+    """Test cases for the C-accelerated loader variant."""
+
+    def test_selected_loader_supports_include(self, temp_dir: Path):
+        """Test that the auto-selected loader resolves !include directives."""
+        from introligo.yaml_loader import get_include_loader
+
+        included = temp_dir / "included.yaml"
+        included.write_text("value: 42", encoding="utf-8")
+        main = temp_dir / "main.yaml"
+        main.write_text("data: !include included.yaml", encoding="utf-8")
+
+        with open(main, encoding="utf-8") as f:
+            data = yaml.load(f, Loader=get_include_loader())
+
+        assert data == {"data": {"value": 42}}
+
+    def test_c_loader_used_when_libyaml_available(self):
+        """Test that libyaml builds select the CSafeLoader-based variant."""
+        from introligo.yaml_loader import CIncludeLoader, get_include_loader
+
+        if getattr(yaml, "__with_libyaml__", False):
+            assert CIncludeLoader is not None
+            assert get_include_loader() is CIncludeLoader
+            assert issubclass(CIncludeLoader, yaml.CSafeLoader)
+        else:
+            assert CIncludeLoader is None
+            assert get_include_loader() is IncludeLoader
+
+    def test_both_variants_parse_nested_includes_identically(self, temp_dir: Path):
+        """Test parity between the pure-Python and C-backed loaders."""
+        from introligo.yaml_loader import CIncludeLoader
+
+        if CIncludeLoader is None:
+            pytest.skip("PyYAML built without libyaml")
+
+        (temp_dir / "nested.yaml").write_text("deep: true", encoding="utf-8")
+        (temp_dir / "child.yaml").write_text(
+            "name: child\nnested: !include nested.yaml", encoding="utf-8"
+        )
+        main = temp_dir / "main.yaml"
+        main.write_text("child: !include child.yaml", encoding="utf-8")
+
+        results = []
+        for loader_cls in (IncludeLoader, CIncludeLoader):
+            with open(main, encoding="utf-8") as f:
+                results.append(yaml.load(f, Loader=loader_cls))
+
+        assert results[0] == results[1]
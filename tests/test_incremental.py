@@ -0,0 +1,137 @@
+"""Tests for incremental generation with the content-hash manifest."""
+
+from pathlib import Path
+
+from introligo import IntroligoGenerator
+
+
+class TestNodeFingerprint:
+    """Test cases for compute_node_fingerprint."""
+
+    def test_fingerprint_is_stable(self, sample_yaml_config: Path, temp_dir: Path):
+        """Test that fingerprinting the same node twice gives the same hash."""
+        generator = IntroligoGenerator(sample_yaml_config, temp_dir / "docs", incremental=True)
+        generator.load_config()
+        generator.build_page_tree()
+        generator.load_template()
+
+        node = generator.page_tree[0]
+        assert generator.compute_node_fingerprint(node) == generator.compute_node_fingerprint(node)
+
+    def test_fingerprint_changes_with_config(self, sample_yaml_config: Path, temp_dir: Path):
+        """Test that changing page config changes the fingerprint."""
+        generator = IntroligoGenerator(sample_yaml_config, temp_dir / "docs", incremental=True)
+        generator.load_config()
+        generator.build_page_tree()
+        generator.load_template()
+
+        node = generator.page_tree[0]
+        before = generator.compute_node_fingerprint(node)
+        node.config["description"] = "Changed description"
+        after = generator.compute_node_fingerprint(node)
+
+        assert before != after
+
+    def test_fingerprint_changes_with_included_file(self, temp_dir: Path, markdown_file: Path):
+        """Test that editing an included markdown file changes the fingerprint."""
+        config_file = temp_dir / "config.yaml"
+        config_file.write_text(
+            f"""
+modules:
+  my_module:
+    title: "My Module"
+    markdown_includes: "{markdown_file.name}"
+""",
+            encoding="utf-8",
+        )
+
+        generator = IntroligoGenerator(config_file, temp_dir / "docs", incremental=True)
+        generator.load_config()
+        generator.build_page_tree()
+        generator.load_template()
+
+        node = generator.page_tree[0]
+        before = generator.compute_node_fingerprint(node)
+        markdown_file.write_text("# Updated\n\nNew content.", encoding="utf-8")
+        after = generator.compute_node_fingerprint(node)
+
+        assert before != after
+
+
+class TestIncrementalGeneration:
+    """Test cases for the incremental generate_all() path."""
+
+    def test_manifest_written_after_generation(self, sample_yaml_config: Path, temp_dir: Path):
+        """Test that a manifest file is persisted after an incremental run."""
+        output_dir = temp_dir / "docs"
+        generator = IntroligoGenerator(sample_yaml_config, output_dir, incremental=True)
+        generated_files = generator.generate_all()
+        generator.write_files(generated_files)
+
+        manifest_path = generator.get_manifest_path()
+        assert manifest_path.exists()
+        assert generator.load_manifest() == generator._manifest_new
+
+    def test_unchanged_pages_are_not_rerendered(self, sample_yaml_config: Path, temp_dir: Path):
+        """Test that a warm run reuses existing RST instead of re-rendering."""
+        output_dir = temp_dir / "docs"
+
+        first = IntroligoGenerator(sample_yaml_config, output_dir, incremental=True)
+        first_files = first.generate_all()
+        first.write_files(first_files)
+
+        second = IntroligoGenerator(sample_yaml_config, output_dir, incremental=True)
+        render_calls = []
+        original = second.generate_rst_content
+
+        def counting_render(node, template):
+            render_calls.append(node.page_id)
+            return original(node, template)
+
+        second.generate_rst_content = counting_render
+        regenerated = second.generate_all()
+
+        assert not render_calls
+        assert set(regenerated) == set(first_files)
+
+    def test_changed_page_is_rerendered(self, temp_dir: Path, markdown_file: Path):
+        """Test that editing an input file causes that page to regenerate."""
+        config_file = temp_dir / "config.yaml"
+        config_file.write_text(
+            f"""
+modules:
+  my_module:
+    title: "My Module"
+    markdown_includes: "{markdown_file.name}"
+""",
+            encoding="utf-8",
+        )
+        output_dir = temp_dir / "docs"
+
+        first = IntroligoGenerator(config_file, output_dir, incremental=True)
+        first.write_files(first.generate_all())
+
+        markdown_file.write_text("# Updated\n\nNew content.", encoding="utf-8")
+
+        second = IntroligoGenerator(config_file, output_dir, incremental=True)
+        render_calls = []
+        original = second.generate_rst_content
+
+        def counting_render(node, template):
+            render_calls.append(node.page_id)
+            return original(node, template)
+
+        second.generate_rst_content = counting_render
+        second.generate_all()
+
+        assert render_calls == ["my_module"]
+
+    def test_dry_run_does_not_write_manifest(self, sample_yaml_config: Path, temp_dir: Path):
+        """Test that dry-run incremental generation leaves no manifest behind."""
+        output_dir = temp_dir / "docs"
+        generator = IntroligoGenerator(
+            sample_yaml_config, output_dir, dry_run=True, incremental=True
+        )
+        generator.generate_all()
+
+        assert not generator.get_manifest_path().exists()
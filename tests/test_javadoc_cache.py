@@ -0,0 +1,142 @@
+"""Tests for parallel Javadoc extraction and the persistent result cache."""
+
+from pathlib import Path
+
+from introligo import IntroligoGenerator
+from introligo.javadoc_extractor import JavaDocExtractor
+
+
+def _write_java_sources(src_dir: Path, count: int = 3) -> None:
+    """Create a few documented Java source files."""
+    src_dir.mkdir(exist_ok=True)
+    for i in range(count):
+        (src_dir / f"Thing{i}.java").write_text(
+            f"""/**
+ * Thing{i} does thing {i}.
+ */
+public class Thing{i} {{
+    /** Returns the id. */
+    public int getId() {{ return {i}; }}
+}}
+""",
+            encoding="utf-8",
+        )
+
+
+def _make_java_config(temp_dir: Path) -> Path:
+    """Create a config page referencing the Java sources individually."""
+    config_file = temp_dir / "config.yaml"
+    config_file.write_text(
+        """
+modules:
+  javamod:
+    title: "Java Module"
+    language: java
+    java_source_path: "src"
+    java_source_files:
+      - "src/Thing0.java"
+      - "src/Thing1.java"
+      - "src/Thing2.java"
+""",
+        encoding="utf-8",
+    )
+    return config_file
+
+
+class TestParallelExtraction:
+    """Test cases for extract_files_parallel()."""
+
+    def test_parallel_matches_serial(self, temp_dir: Path):
+        """Test that parallel extraction returns the serial results in order."""
+        _write_java_sources(temp_dir / "src")
+        extractor = JavaDocExtractor(source_path=temp_dir / "src")
+        files = sorted((temp_dir / "src").glob("*.java"))
+
+        assert extractor.extract_files_parallel(files) == extractor.extract_multiple_files(files)
+
+    def test_single_file_uses_serial_path(self, temp_dir: Path):
+        """Test that one file is handled without spinning up a pool."""
+        _write_java_sources(temp_dir / "src", count=1)
+        extractor = JavaDocExtractor(source_path=temp_dir / "src")
+        files = sorted((temp_dir / "src").glob("*.java"))
+
+        results = extractor.extract_files_parallel(files)
+        assert len(results) == 1
+        assert results[0][1] is True
+
+
+class TestJavadocResultCache:
+    """Test cases for the content-hash result cache."""
+
+    def test_cache_hit_skips_reparse(self, temp_dir: Path, monkeypatch):
+        """Test that identical content is parsed only once."""
+        _write_java_sources(temp_dir / "src", count=1)
+        java_file = temp_dir / "src" / "Thing0.java"
+
+        calls = []
+        original = JavaDocExtractor.parse_java_source
+
+        def counting(self, content, class_name=""):
+            calls.append(1)
+            return original(self, content, class_name)
+
+        monkeypatch.setattr(JavaDocExtractor, "parse_java_source", counting)
+
+        extractor = JavaDocExtractor()
+        extractor.result_cache = {}
+        first = extractor.extract_and_convert(java_file)
+        second = extractor.extract_and_convert(java_file)
+
+        assert len(calls) == 1
+        assert first == second
+
+    def test_warm_run_skips_all_parsing(self, temp_dir: Path, monkeypatch):
+        """Test that a second generation run re-parses nothing."""
+        _write_java_sources(temp_dir / "src")
+        config_file = _make_java_config(temp_dir)
+
+        calls = []
+        original = JavaDocExtractor.parse_java_source
+
+        def counting(self, content, class_name=""):
+            calls.append(1)
+            return original(self, content, class_name)
+
+        monkeypatch.setattr(JavaDocExtractor, "parse_java_source", counting)
+
+        first = IntroligoGenerator(config_file, temp_dir / "docs")
+        first.write_files(first.generate_all())
+        assert len(calls) == 3
+        assert first.get_javadoc_cache_path().exists()
+
+        calls.clear()
+        second = IntroligoGenerator(config_file, temp_dir / "docs")
+        second.generate_all()
+        assert calls == []
+
+    def test_changed_file_is_reparsed(self, temp_dir: Path, monkeypatch):
+        """Test that only edited files are re-parsed on the next run."""
+        _write_java_sources(temp_dir / "src")
+        config_file = _make_java_config(temp_dir)
+
+        first = IntroligoGenerator(config_file, temp_dir / "docs")
+        first.write_files(first.generate_all())
+
+        calls = []
+        original = JavaDocExtractor.parse_java_source
+
+        def counting(self, content, class_name=""):
+            calls.append(1)
+            return original(self, content, class_name)
+
+        monkeypatch.setattr(JavaDocExtractor, "parse_java_source", counting)
+
+        changed = temp_dir / "src" / "Thing1.java"
+        changed.write_text(
+            changed.read_text(encoding="utf-8").replace("thing 1", "thing ONE"),
+            encoding="utf-8",
+        )
+
+        second = IntroligoGenerator(config_file, temp_dir / "docs")
+        second.generate_all()
+        assert len(calls) == 1
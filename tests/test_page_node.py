@@ -201,3 +201,50 @@ class TestPageNode:
         # Should not contain backslashes
         assert "\\" not in relative_path
         assert "/" in relative_path or relative_path == "test_module"
+
+
+class TestPrecomputedPaths:
+    """Test the precomputed path index filled by compute_paths()."""
+
+    def test_compute_paths_matches_lazy_walk(self):
+        """Test that cached paths equal the parent-pointer walk."""
+        base = Path("/docs/generated")
+        root = PageNode("root", {"title": "Root"})
+        child = PageNode("child", {"title": "Child"}, parent=root)
+        root.children.append(child)
+        grandchild = PageNode("grandchild", {"title": "Grand Child"}, parent=child)
+        child.children.append(grandchild)
+
+        expected_dir = grandchild.get_output_dir(base)
+        expected_file = grandchild.get_output_file(base)
+
+        for node in (root, child, grandchild):
+            node.compute_paths(base)
+
+        assert grandchild.get_output_dir(base) == expected_dir
+        assert grandchild.get_output_file(base) == expected_file
+        assert grandchild._path_index[base] == (expected_dir, expected_file)
+
+    def test_relative_path_memoized_after_compute(self):
+        """Test that relative paths are served from the cache once frozen."""
+        base = Path("/docs/generated")
+        root = PageNode("root", {"title": "Root"})
+        child = PageNode("child", {"title": "Child"}, parent=root)
+        root.children.append(child)
+        for node in (root, child):
+            node.compute_paths(base)
+
+        parent_dir = root.get_output_dir(base)
+        first = child.get_relative_path_from(parent_dir, base)
+        assert child._relative_path_cache
+        assert child.get_relative_path_from(parent_dir, base) == first
+
+    def test_late_parent_assignment_stays_correct(self):
+        """Test that nodes without precomputed paths still resolve lazily."""
+        base = Path("/docs/generated")
+        node = PageNode("page", {"title": "Page"})
+        assert node.get_output_dir(base) == base
+
+        parent = PageNode("parent", {"title": "Parent"})
+        node.parent = parent
+        assert node.get_output_dir(base) == base / parent.slug
@@ -0,0 +1,76 @@
+"""Tests for the parallel page rendering pool."""
+
+from pathlib import Path
+
+import pytest
+
+from introligo import IntroligoGenerator
+from introligo.errors import IntroligoError
+
+
+class TestParallelRendering:
+    """Test cases for generate_all_nodes() with multiple workers."""
+
+    def test_parallel_matches_serial_output(self, sample_yaml_config: Path, temp_dir: Path):
+        """Test that parallel rendering produces the same files as serial."""
+        serial = IntroligoGenerator(sample_yaml_config, temp_dir / "serial")
+        serial_files = serial.generate_all()
+
+        parallel = IntroligoGenerator(sample_yaml_config, temp_dir / "parallel", jobs=4)
+        parallel_files = parallel.generate_all()
+
+        serial_contents = {
+            path.relative_to(temp_dir / "serial"): content
+            for content, path in serial_files.values()
+        }
+        parallel_contents = {
+            path.relative_to(temp_dir / "parallel"): content
+            for content, path in parallel_files.values()
+        }
+        assert serial_contents == parallel_contents
+
+    def test_zero_jobs_uses_cpu_count(self, sample_yaml_config: Path, temp_dir: Path):
+        """Test that jobs=0 still renders every page."""
+        generator = IntroligoGenerator(sample_yaml_config, temp_dir / "docs", jobs=0)
+        generated_files = generator.generate_all()
+
+        rst_files = [path for _, path in generated_files.values() if path.suffix == ".rst"]
+        assert len(rst_files) == 4  # three pages plus index
+
+    def test_strict_mode_raises_in_parallel(self, sample_yaml_config: Path, temp_dir: Path):
+        """Test that strict error semantics are preserved with workers."""
+        generator = IntroligoGenerator(
+            sample_yaml_config, temp_dir / "docs", strict=True, jobs=4
+        )
+        generator.load_config()
+        generator.build_page_tree()
+        template = generator.load_template()
+
+        def failing_render(node, tmpl):
+            raise ValueError("boom")
+
+        generator.generate_rst_content = failing_render
+
+        with pytest.raises(IntroligoError, match="Strict mode"):
+            generator.generate_all_nodes(generator.page_tree, template, strict=True)
+
+    def test_non_strict_skips_failing_pages(self, sample_yaml_config: Path, temp_dir: Path):
+        """Test that non-strict parallel rendering skips failures and continues."""
+        generator = IntroligoGenerator(sample_yaml_config, temp_dir / "docs", jobs=4)
+        generator.load_config()
+        generator.build_page_tree()
+        template = generator.load_template()
+
+        original = generator.generate_rst_content
+
+        def flaky_render(node, tmpl):
+            if node.page_id == "my_module":
+                raise ValueError("boom")
+            return original(node, tmpl)
+
+        generator.generate_rst_content = flaky_render
+        generated_files = generator.generate_all_nodes(generator.page_tree, template)
+
+        titles = [path.stem for _, path in generated_files.values()]
+        assert "my_module" not in titles
+        assert len(generated_files) == 2
@@ -0,0 +1,101 @@
+"""Tests for the --profile timing instrumentation."""
+
+import json
+from pathlib import Path
+
+from introligo import IntroligoGenerator, Profiler
+
+
+def _make_config(temp_dir: Path) -> Path:
+    """Create a small config with a markdown include."""
+    (temp_dir / "notes.md").write_text("# Notes\n\nSome text.", encoding="utf-8")
+    config_file = temp_dir / "config.yaml"
+    config_file.write_text(
+        """
+modules:
+  first:
+    title: "First"
+    markdown_includes: "notes.md"
+  second:
+    title: "Second"
+""",
+        encoding="utf-8",
+    )
+    return config_file
+
+
+class TestProfiler:
+    """Test cases for the Profiler class."""
+
+    def test_phase_and_page_accumulation(self):
+        """Test that repeated timings accumulate per name."""
+        profiler = Profiler()
+        with profiler.phase("render"):
+            pass
+        with profiler.phase("render"):
+            pass
+        with profiler.page("page_a"):
+            pass
+
+        assert set(profiler.phases) == {"render"}
+        assert profiler.phases["render"] >= 0.0
+        assert set(profiler.pages) == {"page_a"}
+
+    def test_top_pages_sorted_and_limited(self):
+        """Test that top_pages ranks by descending time."""
+        profiler = Profiler()
+        profiler.pages = {"slow": 3.0, "fast": 0.1, "medium": 1.0}
+
+        top = profiler.top_pages(limit=2)
+        assert top == [("slow", 3.0), ("medium", 1.0)]
+
+    def test_report_mentions_phases_and_pages(self):
+        """Test that the summary lists recorded entries."""
+        profiler = Profiler()
+        with profiler.phase("load_config"):
+            pass
+        with profiler.page("landing"):
+            pass
+
+        report = profiler.report()
+        assert "load_config" in report
+        assert "landing" in report
+        assert "Total wall time" in report
+
+    def test_save_json_round_trip(self, temp_dir: Path):
+        """Test that exported JSON carries the raw timing buckets."""
+        profiler = Profiler()
+        with profiler.phase("render"):
+            pass
+        out = temp_dir / "profile" / "run.json"
+        profiler.save_json(out)
+
+        data = json.loads(out.read_text(encoding="utf-8"))
+        assert "render" in data["phases"]
+        assert "total_seconds" in data
+
+
+class TestGeneratorProfiling:
+    """Test that generation runs feed the profiler."""
+
+    def test_generate_all_records_phases_and_pages(self, temp_dir: Path):
+        """Test that a profiled run records the pipeline phases."""
+        config_file = _make_config(temp_dir)
+        profiler = Profiler()
+
+        generator = IntroligoGenerator(config_file, temp_dir / "docs", profiler=profiler)
+        generator.write_files(generator.generate_all())
+
+        for phase in ("load_config", "build_page_tree", "render", "write_files"):
+            assert phase in profiler.phases
+        assert {"first", "second"} <= set(profiler.pages)
+        assert "include_markdown" in profiler.helpers
+
+    def test_unprofiled_run_unaffected(self, temp_dir: Path):
+        """Test that generation works without a profiler attached."""
+        config_file = _make_config(temp_dir)
+        generator = IntroligoGenerator(config_file, temp_dir / "docs")
+        generated = generator.generate_all()
+
+        assert generator.profiler is None
+        assert generated
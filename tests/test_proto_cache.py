@@ -0,0 +1,158 @@
+"""Tests for the shared parsed-proto cache and protobuf diagram reuse."""
+
+from pathlib import Path
+
+import introligo.generator as generator_module
+from introligo import IntroligoGenerator
+from introligo.protodoc_extractor import ProtoDocExtractor
+
+PROTO_SOURCE = '''syntax = "proto3";
+package demo.v1;
+
+// A user account.
+message User {
+  int64 id = 1;
+  string name = 2;
+}
+
+service UserService {
+  rpc GetUser(User) returns (User);
+}
+'''
+
+
+def _make_proto_config(temp_dir: Path) -> Path:
+    """Create a proto file and a config page that documents and diagrams it."""
+    (temp_dir / "svc.proto").write_text(PROTO_SOURCE, encoding="utf-8")
+    config_file = temp_dir / "config.yaml"
+    config_file.write_text(
+        """
+modules:
+  api:
+    title: "API"
+    language: protobuf
+    proto_path: "."
+    protobuf_diagrams:
+      - type: class
+        title: "Class Diagram"
+""",
+        encoding="utf-8",
+    )
+    return config_file
+
+
+class TestParsedProtoCache:
+    """Test cases for the content-hash parse cache on ProtoDocExtractor."""
+
+    def test_cache_hit_skips_reparse(self, monkeypatch):
+        """Test that identical content is parsed only once."""
+        calls = []
+        original = ProtoDocExtractor._parse_messages
+
+        def counting(self, content, lines):
+            calls.append(1)
+            return original(self, content, lines)
+
+        monkeypatch.setattr(ProtoDocExtractor, "_parse_messages", counting)
+
+        extractor = ProtoDocExtractor()
+        extractor.parse_cache = {}
+        first = extractor.parse_proto_file(PROTO_SOURCE)
+        second = extractor.parse_proto_file(PROTO_SOURCE)
+
+        assert len(calls) == 1
+        assert first is second
+
+    def test_no_cache_keeps_old_behavior(self):
+        """Test that parsing without an attached cache returns fresh models."""
+        extractor = ProtoDocExtractor()
+        first = extractor.parse_proto_file(PROTO_SOURCE)
+        second = extractor.parse_proto_file(PROTO_SOURCE)
+
+        assert first == second
+        assert first is not second
+
+    def test_generation_parses_each_proto_once(self, temp_dir: Path, monkeypatch):
+        """Test that documentation and diagrams share one parse per file."""
+        config_file = _make_proto_config(temp_dir)
+
+        calls = []
+        original = ProtoDocExtractor._parse_messages
+
+        def counting(self, content, lines):
+            calls.append(1)
+            return original(self, content, lines)
+
+        monkeypatch.setattr(ProtoDocExtractor, "_parse_messages", counting)
+
+        generator = IntroligoGenerator(config_file, temp_dir / "docs")
+        generator.write_files(generator.generate_all())
+
+        assert len(calls) == 1
+
+
+class TestDiagramCache:
+    """Test cases for skipping diagram regeneration on unchanged schemas."""
+
+    def test_diagrams_reused_when_schema_unchanged(self, temp_dir: Path, monkeypatch):
+        """Test that a second run with the same proto reuses diagram files."""
+        config_file = _make_proto_config(temp_dir)
+
+        calls = []
+        original = generator_module.generate_proto_diagrams
+
+        def counting(*args, **kwargs):
+            calls.append(1)
+            return original(*args, **kwargs)
+
+        monkeypatch.setattr(generator_module, "generate_proto_diagrams", counting)
+
+        first = IntroligoGenerator(config_file, temp_dir / "docs")
+        first.write_files(first.generate_all())
+        assert calls == [1]
+        assert first.get_diagram_cache_path().exists()
+
+        second = IntroligoGenerator(config_file, temp_dir / "docs")
+        second.write_files(second.generate_all())
+        assert calls == [1], "diagram regenerated despite unchanged schema"
+
+    def test_diagrams_regenerated_on_schema_change(self, temp_dir: Path, monkeypatch):
+        """Test that editing the proto invalidates the diagram cache."""
+        config_file = _make_proto_config(temp_dir)
+
+        calls = []
+        original = generator_module.generate_proto_diagrams
+
+        def counting(*args, **kwargs):
+            calls.append(1)
+            return original(*args, **kwargs)
+
+        monkeypatch.setattr(generator_module, "generate_proto_diagrams", counting)
+
+        first = IntroligoGenerator(config_file, temp_dir / "docs")
+        first.write_files(first.generate_all())
+
+        proto_file = temp_dir / "svc.proto"
+        proto_file.write_text(
+            PROTO_SOURCE.replace("string name = 2;", "string email = 2;"), encoding="utf-8"
+        )
+
+        second = IntroligoGenerator(config_file, temp_dir / "docs")
+        second.write_files(second.generate_all())
+        assert calls == [1, 1]
+
+    def test_missing_diagram_file_invalidates_cache(self, temp_dir: Path):
+        """Test that deleted diagram files are regenerated on the next run."""
+        config_file = _make_proto_config(temp_dir)
+
+        first = IntroligoGenerator(config_file, temp_dir / "docs")
+        first.write_files(first.generate_all())
+
+        diagrams_dir = temp_dir / "docs" / "diagrams" / "generated"
+        for diagram in diagrams_dir.iterdir():
+            diagram.unlink()
+
+        second = IntroligoGenerator(config_file, temp_dir / "docs")
+        second.write_files(second.generate_all())
+
+        assert any(diagrams_dir.iterdir()), "diagram files were not regenerated"
@@ -836,3 +836,25 @@ class TestProtoDocExtractor:
         assert "UserService" in result
         assert "GetUser" in result
         assert "GetUserRequest" in result
+
+
+class TestLineOffsetIndex:
+    """Test cases for the newline offset index used during parsing."""
+
+    def test_line_at_matches_prefix_count(self):
+        """Test that the offset index agrees with counting the prefix."""
+        from introligo.protodoc_extractor import _line_at, _newline_offsets
+
+        text = 'syntax = "proto3";\n\nmessage A {\n  int32 x = 1;\n}\n'
+        offsets = _newline_offsets(text)
+
+        for pos in range(len(text)):
+            assert _line_at(offsets, pos) == text[:pos].count("\n")
+
+    def test_empty_text_has_no_offsets(self):
+        """Test indexing of text without newlines."""
+        from introligo.protodoc_extractor import _line_at, _newline_offsets
+
+        assert _newline_offsets("") == []
+        assert _line_at([], 0) == 0
+        assert _line_at(_newline_offsets("single line"), 5) == 0
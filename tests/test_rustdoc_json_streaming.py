@@ -0,0 +1,98 @@
+"""Tests for the bounded-memory streaming parse of rustdoc JSON."""
+
+import json
+from pathlib import Path
+
+import introligo.rustdoc_extractor as rustdoc_module
+from introligo.rustdoc_extractor import RustDocExtractor
+
+
+def _write_rustdoc_json(temp_dir: Path, **overrides) -> Path:
+    """Write a representative rustdoc JSON document and return its path."""
+    doc = {
+        "root": 7,
+        "crate_version": "1.0.0",
+        "index": {
+            "1": {"name": "helper", "docs": "internal helper"},
+            "7": {"name": "mycrate", "docs": "Crate level docs.", "visibility": "public"},
+            "9": {"name": "tricky", "docs": 'Has "quotes", {braces} and [brackets]'},
+        },
+        "paths": {
+            "7": {"crate_id": 0, "path": ["mycrate"], "kind": "module"},
+            "12": {"crate_id": 0, "path": ["mycrate", "foo", "bar"], "kind": "function"},
+            "44": {"crate_id": 3, "path": ["std", "vec"], "kind": "module"},
+        },
+        "format_version": 30,
+    }
+    doc.update(overrides)
+    json_file = temp_dir / "mycrate.json"
+    json_file.write_text(json.dumps(doc), encoding="utf-8")
+    return json_file
+
+
+class TestRustdocJsonStreaming:
+    """Test cases for _parse_rustdoc_json() and its streaming scanner."""
+
+    def test_extracts_crate_docs_and_public_items(self, temp_dir: Path):
+        """Test that crate root docs and local item paths are extracted."""
+        json_file = _write_rustdoc_json(temp_dir)
+        result = RustDocExtractor()._parse_rustdoc_json(json_file)
+
+        assert result is not None
+        assert "Crate level docs." in result
+        assert "- ``mycrate::foo::bar``" in result
+        # Items from external crates are not listed
+        assert "std::vec" not in result
+
+    def test_small_chunks_cross_token_boundaries(self, temp_dir: Path, monkeypatch):
+        """Test that parsing is correct when chunks split JSON tokens."""
+        json_file = _write_rustdoc_json(temp_dir)
+        monkeypatch.setattr(rustdoc_module, "_JSON_CHUNK_SIZE", 7)
+
+        result = RustDocExtractor()._parse_rustdoc_json(json_file)
+
+        assert result is not None
+        assert "Crate level docs." in result
+        assert "mycrate::foo::bar" in result
+
+    def test_string_root_id(self, temp_dir: Path):
+        """Test the older rustdoc format where the root id is a string."""
+        json_file = _write_rustdoc_json(
+            temp_dir,
+            root="0:0:1",
+            index={"0:0:1": {"name": "mycrate", "docs": "Old format docs."}},
+        )
+        result = RustDocExtractor()._parse_rustdoc_json(json_file)
+
+        assert result is not None
+        assert "Old format docs." in result
+
+    def test_missing_root_returns_none(self, temp_dir: Path):
+        """Test that a document without a root id yields no output."""
+        json_file = temp_dir / "no_root.json"
+        json_file.write_text('{"index": {}, "paths": {}}', encoding="utf-8")
+
+        assert RustDocExtractor()._parse_rustdoc_json(json_file) is None
+
+    def test_member_iteration_round_trips(self, temp_dir: Path, monkeypatch):
+        """Test that every streamed index member decodes to the original value."""
+        json_file = _write_rustdoc_json(temp_dir)
+        monkeypatch.setattr(rustdoc_module, "_JSON_CHUNK_SIZE", 13)
+        expected = json.loads(json_file.read_text(encoding="utf-8"))["index"]
+
+        with open(json_file, encoding="utf-8") as f:
+            members = RustDocExtractor._iter_json_object_members(f, ("index",))
+            decoded = {key: json.loads(raw) for key, raw in members if raw is not None}
+
+        assert decoded == expected
+
+    def test_skipped_members_are_not_buffered(self, temp_dir: Path):
+        """Test that unwanted top-level members are skipped without capture."""
+        json_file = _write_rustdoc_json(temp_dir)
+
+        with open(json_file, encoding="utf-8") as f:
+            members = dict(RustDocExtractor._iter_json_object_members(f, (), wanted={"root"}))
+
+        assert members["root"] == "7"
+        assert members["index"] is None
+        assert members["paths"] is None
@@ -959,3 +959,67 @@ modules:
             # Restore template file
             if backup_path.exists():
                 shutil.move(str(backup_path), str(template_path))
+
+
+class TestPaletteCache:
+    """Test cases for the content-hash palette cache."""
+
+    def test_repeated_load_parses_once(self, sample_yaml_config: Path, temp_dir: Path, monkeypatch):
+        """Test that loading the same palette twice skips the YAML parse."""
+        import introligo.generator as generator_module
+        from introligo.generator import _palette_cache
+
+        _palette_cache.clear()
+        palette_file = temp_dir / "my_palette.yaml"
+        palette_file.write_text(
+            'name: "Mine"\ncolors:\n  primary:\n    main: "#123456"\n',
+            encoding="utf-8",
+        )
+
+        calls = []
+        original = generator_module.yaml.load
+
+        def counting(stream, Loader):
+            calls.append(1)
+            return original(stream, Loader=Loader)
+
+        monkeypatch.setattr(generator_module.yaml, "load", counting)
+
+        generator = IntroligoGenerator(sample_yaml_config, temp_dir / "output")
+        first = generator.load_palette(str(palette_file))
+        second = generator.load_palette(str(palette_file))
+
+        assert len(calls) == 1
+        assert first == second
+
+    def test_edited_palette_is_reparsed(self, sample_yaml_config: Path, temp_dir: Path):
+        """Test that changing the palette file content bypasses the cache."""
+        from introligo.generator import _palette_cache
+
+        _palette_cache.clear()
+        palette_file = temp_dir / "my_palette.yaml"
+        palette_file.write_text('name: "Before"\ncolors: {}\n', encoding="utf-8")
+
+        generator = IntroligoGenerator(sample_yaml_config, temp_dir / "output")
+        assert generator.load_palette(str(palette_file))["name"] == "Before"
+
+        palette_file.write_text('name: "After"\ncolors: {}\n', encoding="utf-8")
+        assert generator.load_palette(str(palette_file))["name"] == "After"
+
+    def test_cached_palette_is_not_shared(self, sample_yaml_config: Path, temp_dir: Path):
+        """Test that mutating a loaded palette does not poison the cache."""
+        from introligo.generator import _palette_cache
+
+        _palette_cache.clear()
+        palette_file = temp_dir / "my_palette.yaml"
+        palette_file.write_text(
+            'name: "Mine"\ncolors:\n  primary:\n    main: "#123456"\n',
+            encoding="utf-8",
+        )
+
+        generator = IntroligoGenerator(sample_yaml_config, temp_dir / "output")
+        first = generator.load_palette(str(palette_file))
+        first["colors"]["primary"]["main"] = "#ffffff"
+
+        second = generator.load_palette(str(palette_file))
+        assert second["colors"]["primary"]["main"] == "#123456"
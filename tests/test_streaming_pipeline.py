@@ -0,0 +1,119 @@
+"""Tests for the streaming generate-and-write pipeline."""
+
+from pathlib import Path
+
+from introligo import IntroligoGenerator
+
+
+def _make_config(temp_dir: Path, module_count: int = 5) -> Path:
+    """Create a config with several simple modules."""
+    lines = ["modules:"]
+    for i in range(module_count):
+        lines.append(f"  mod{i}:")
+        lines.append(f'    title: "Module {i}"')
+        lines.append(f'    description: "Description of module {i}"')
+    config_file = temp_dir / "config.yaml"
+    config_file.write_text("\n".join(lines) + "\n", encoding="utf-8")
+    return config_file
+
+
+def _rst_files(output_dir: Path) -> dict:
+    """Map relative RST paths to their content."""
+    return {
+        str(p.relative_to(output_dir)): p.read_text(encoding="utf-8")
+        for p in sorted(output_dir.rglob("*.rst"))
+    }
+
+
+class TestGenerateAndWrite:
+    """Test cases for generate_and_write()."""
+
+    def test_matches_batch_pipeline(self, temp_dir: Path):
+        """Test that streaming output is identical to generate_all + write_files."""
+        config_file = _make_config(temp_dir)
+
+        batch = IntroligoGenerator(config_file, temp_dir / "batch")
+        batch.write_files(batch.generate_all())
+
+        stream = IntroligoGenerator(config_file, temp_dir / "stream")
+        file_count = stream.generate_and_write()
+
+        batch_files = _rst_files(temp_dir / "batch")
+        stream_files = _rst_files(temp_dir / "stream")
+        assert stream_files == batch_files
+        assert file_count == len(stream_files)
+
+    def test_parallel_streaming_matches_serial(self, temp_dir: Path):
+        """Test that a multi-worker streaming run writes the same files."""
+        config_file = _make_config(temp_dir, module_count=8)
+
+        serial = IntroligoGenerator(config_file, temp_dir / "serial")
+        serial.generate_and_write()
+
+        parallel = IntroligoGenerator(config_file, temp_dir / "parallel", jobs=4)
+        parallel.generate_and_write()
+
+        assert _rst_files(temp_dir / "parallel") == _rst_files(temp_dir / "serial")
+
+    def test_dry_run_writes_nothing(self, temp_dir: Path):
+        """Test that dry-run streaming reports pages without creating files."""
+        config_file = _make_config(temp_dir)
+        output_dir = temp_dir / "docs"
+
+        generator = IntroligoGenerator(config_file, output_dir, dry_run=True)
+        file_count = generator.generate_and_write()
+
+        assert file_count > 0
+        assert not output_dir.exists()
+
+    def test_index_generation_respected(self, temp_dir: Path):
+        """Test that generate_index: false skips the index in streaming mode."""
+        config_file = temp_dir / "config.yaml"
+        config_file.write_text(
+            'generate_index: false\nmodules:\n  only:\n    title: "Only"\n',
+            encoding="utf-8",
+        )
+
+        generator = IntroligoGenerator(config_file, temp_dir / "docs")
+        generator.generate_and_write()
+
+        assert not (temp_dir / "docs" / "index.rst").exists()
+        assert list((temp_dir / "docs").rglob("*.rst"))
+
+
+class TestStreamRenderedNodes:
+    """Test cases for the bounded render stream."""
+
+    def test_pages_yielded_in_depth_first_order(self, temp_dir: Path):
+        """Test that streamed pages follow the collected node order."""
+        config_file = temp_dir / "config.yaml"
+        config_file.write_text(
+            """
+modules:
+  parent:
+    title: "Parent"
+  child:
+    title: "Child"
+    parent: parent
+  other:
+    title: "Other"
+""",
+            encoding="utf-8",
+        )
+
+        generator = IntroligoGenerator(config_file, temp_dir / "docs")
+        generator.load_config()
+        generator.build_page_tree()
+        template = generator.load_template()
+
+        expected = [
+            node.get_output_file(generator.paths.generated_dir)
+            for node in generator._collect_nodes(generator.page_tree)
+        ]
+        streamed = [
+            output_file
+            for _, output_file in generator._stream_rendered_nodes(
+                generator.page_tree, template, strict=False, jobs=2
+            )
+        ]
+        assert streamed == expected
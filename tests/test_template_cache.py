@@ -0,0 +1,59 @@
+"""Tests for the persistent Jinja2 template bytecode cache."""
+
+from pathlib import Path
+
+from introligo import IntroligoGenerator
+
+
+class TestTemplateBytecodeCache:
+    """Test cases for load_template() bytecode caching."""
+
+    def test_cache_populated_on_load(self, sample_yaml_config: Path, temp_dir: Path):
+        """Test that loading the template writes a bytecode cache entry."""
+        output_dir = temp_dir / "docs"
+        generator = IntroligoGenerator(sample_yaml_config, output_dir)
+        generator.load_template()
+
+        cache_dir = output_dir / ".introligo_cache" / "jinja2"
+        assert cache_dir.is_dir()
+        assert list(cache_dir.iterdir())
+
+    def test_cached_template_renders_identically(self, sample_yaml_config: Path, temp_dir: Path):
+        """Test that a cache hit produces the same output as a cold compile."""
+        output_dir = temp_dir / "docs"
+
+        cold = IntroligoGenerator(sample_yaml_config, output_dir)
+        cold_files = cold.generate_all()
+
+        warm = IntroligoGenerator(sample_yaml_config, output_dir)
+        warm_files = warm.generate_all()
+
+        assert {k: v[0] for k, v in cold_files.items()} == {
+            k: v[0] for k, v in warm_files.items()
+        }
+
+    def test_custom_template_uses_distinct_cache_key(self, sample_yaml_config: Path, temp_dir: Path):
+        """Test that a custom template does not reuse the default's cache entry."""
+        output_dir = temp_dir / "docs"
+
+        default_gen = IntroligoGenerator(sample_yaml_config, output_dir)
+        default_gen.load_template()
+        default_hash = default_gen._template_hash
+
+        custom_template = temp_dir / "custom.jinja2"
+        custom_template.write_text("{{ title }}\ncustom body\n", encoding="utf-8")
+        custom_gen = IntroligoGenerator(
+            sample_yaml_config, output_dir, template_file=custom_template
+        )
+        template = custom_gen.load_template()
+
+        assert custom_gen._template_hash != default_hash
+        assert "custom body" in template.render(title="X")
+
+    def test_dry_run_skips_cache_directory(self, sample_yaml_config: Path, temp_dir: Path):
+        """Test that dry runs do not create cache directories in the output."""
+        output_dir = temp_dir / "docs"
+        generator = IntroligoGenerator(sample_yaml_config, output_dir, dry_run=True)
+        generator.load_template()
+
+        assert not (output_dir / ".introligo_cache").exists()
@@ -0,0 +1,96 @@
+"""Tests for watch-mode helpers in the CLI entry point."""
+
+from pathlib import Path
+
+from introligo import IntroligoGenerator
+from introligo.__main__ import collect_watched_files, snapshot_mtimes
+from introligo.yaml_loader import clear_include_cache, get_cached_include_paths
+
+
+class TestCollectWatchedFiles:
+    """Test cases for collect_watched_files()."""
+
+    def test_config_and_content_includes_watched(self, temp_dir: Path):
+        """Test that the config and include_* files end up in the watch set."""
+        (temp_dir / "notes.md").write_text("# Notes\n\nText.", encoding="utf-8")
+        config_file = temp_dir / "config.yaml"
+        config_file.write_text(
+            'modules:\n  mod:\n    title: "Mod"\n    markdown_includes: "notes.md"\n',
+            encoding="utf-8",
+        )
+
+        generator = IntroligoGenerator(config_file, temp_dir / "docs")
+        generator.write_files(generator.generate_all())
+
+        watched = collect_watched_files(generator)
+        assert config_file.resolve() in watched
+        assert (temp_dir / "notes.md").resolve() in watched
+
+    def test_yaml_include_graph_watched(self, temp_dir: Path):
+        """Test that files loaded through !include are in the watch set."""
+        clear_include_cache()
+        (temp_dir / "module.yaml").write_text('title: "Included"\n', encoding="utf-8")
+        config_file = temp_dir / "config.yaml"
+        config_file.write_text("modules:\n  mod: !include module.yaml\n", encoding="utf-8")
+
+        generator = IntroligoGenerator(config_file, temp_dir / "docs")
+        generator.write_files(generator.generate_all())
+
+        assert (temp_dir / "module.yaml").resolve() in {
+            p.resolve() for p in get_cached_include_paths()
+        }
+        assert (temp_dir / "module.yaml").resolve() in collect_watched_files(generator)
+
+    def test_custom_template_watched(self, temp_dir: Path):
+        """Test that a custom template file is watched."""
+        template = temp_dir / "custom.jinja2"
+        template.write_text("{{ title }}", encoding="utf-8")
+        config_file = temp_dir / "config.yaml"
+        config_file.write_text('modules:\n  mod:\n    title: "Mod"\n', encoding="utf-8")
+
+        generator = IntroligoGenerator(config_file, temp_dir / "docs", template_file=template)
+        watched = collect_watched_files(generator)
+        assert template.resolve() in watched
+
+
+class TestSnapshotMtimes:
+    """Test cases for snapshot_mtimes()."""
+
+    def test_snapshot_detects_change(self, temp_dir: Path):
+        """Test that an edit shows up as a differing snapshot entry."""
+        target = temp_dir / "file.md"
+        target.write_text("before", encoding="utf-8")
+        files = {target.resolve()}
+
+        before = snapshot_mtimes(files)
+        target.write_text("after", encoding="utf-8")
+        after = snapshot_mtimes(files)
+
+        assert before[target.resolve()] != after[target.resolve()]
+
+    def test_missing_file_recorded_as_sentinel(self, temp_dir: Path):
+        """Test that a deleted watched file maps to -1."""
+        missing = (temp_dir / "gone.yaml").resolve()
+        snapshot = snapshot_mtimes({missing})
+        assert snapshot[missing] == -1
+
+
+class TestWatchCliFlags:
+    """Test the --watch argument wiring."""
+
+    def test_watch_rejects_dry_run(self, temp_dir: Path, monkeypatch, capsys):
+        """Test that --watch combined with --dry-run is refused."""
+        import pytest
+
+        from introligo.__main__ import main
+
+        config_file = temp_dir / "config.yaml"
+        config_file.write_text('modules:\n  mod:\n    title: "Mod"\n', encoding="utf-8")
+
+        monkeypatch.setattr(
+            "sys.argv",
+            ["introligo", str(config_file), "-o", str(temp_dir / "docs"), "--watch", "--dry-run"],
+        )
+        with pytest.raises(SystemExit):
+            main()
+        assert "--watch cannot be combined with --dry-run" in capsys.readouterr().err
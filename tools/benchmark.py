@@ -0,0 +1,261 @@
+#!/usr/bin/env python3
+"""
+Performance benchmark suite for Introligo hot paths.
+
+Generates synthetic configurations (parameterized page count, tree depth,
+include-file sizes and markdown/proto mix), times the hot paths and tracks
+results run-over-run in a JSON history file so regressions fail loudly.
+
+Usage:
+    python tools/benchmark.py                      # run and record
+    python tools/benchmark.py --pages 500 --depth 7
+    python tools/benchmark.py --check              # fail on regression
+"""
+
+import argparse
+import json
+import statistics
+import sys
+import tempfile
+import time
+from pathlib import Path
+from typing import Any, Callable, Dict
+
+sys.path.insert(0, str(Path(__file__).resolve().parent.parent))
+
+from introligo import IntroligoGenerator  # noqa: E402
+from introligo.hub import DocumentationHub  # noqa: E402
+from introligo.markdown_converter import convert_markdown_to_rst  # noqa: E402
+from introligo.protodoc_extractor import ProtoDocExtractor  # noqa: E402
+
+DEFAULT_RESULTS = Path(__file__).parent / "benchmark_results.json"
+
+
+def make_markdown(size_kb: int) -> str:
+    """Build a synthetic markdown document of roughly the given size."""
+    block = (
+        "# Section\n\n"
+        "Some **bold** text with a [link](https://example.com) and `code`.\n\n"
+        "## Subsection\n\n"
+        "| Col A | Col B |\n|-------|-------|\n| 1     | 2     |\n\n"
+        "```python\nprint('hello')\n```\n\n"
+    )
+    repeats = max(1, (size_kb * 1024) // len(block))
+    return block * repeats
+
+
+def make_proto(messages: int) -> str:
+    """Build a synthetic .proto schema with the given number of messages."""
+    parts = ['syntax = "proto3";\n\npackage bench.v1;\n\n']
+    for i in range(messages):
+        parts.append(f"// Message number {i} in the benchmark schema.\n")
+        parts.append(f"message Bench{i} {{\n")
+        for j in range(5):
+            parts.append(f"  // Field {j} of Bench{i}.\n")
+            parts.append(f"  string field_{j} = {j + 1};\n")
+        parts.append("}\n\n")
+    return "".join(parts)
+
+
+def build_synthetic_config(
+    root: Path,
+    pages: int,
+    depth: int,
+    include_kb: int,
+) -> Path:
+    """Write a synthetic config tree under root and return the config path.
+
+    Pages are chained into parent/child branches of the requested depth,
+    and every page pulls in a shared markdown include of include_kb size.
+
+    Args:
+        root: Directory to populate.
+        pages: Total number of pages to generate.
+        depth: Nesting depth of each branch.
+        include_kb: Approximate size of the shared markdown include.
+
+    Returns:
+        Path to the written config file.
+    """
+    (root / "shared.md").write_text(make_markdown(include_kb), encoding="utf-8")
+
+    lines = ["modules:"]
+    for i in range(pages):
+        level = i % depth
+        lines.append(f"  page{i}:")
+        lines.append(f'    title: "Page {i}"')
+        lines.append(f'    description: "Synthetic page {i}"')
+        lines.append('    markdown_includes: "shared.md"')
+        if level > 0:
+            lines.append(f"    parent: page{i - 1}")
+
+    config_file = root / "config.yaml"
+    config_file.write_text("\n".join(lines) + "\n", encoding="utf-8")
+    return config_file
+
+
+def build_synthetic_repo(root: Path, guides: int) -> Path:
+    """Populate a repository-like tree for hub discovery benchmarks."""
+    (root / "README.md").write_text("# Project\n\nOverview.", encoding="utf-8")
+    (root / "CHANGELOG.md").write_text("# Changelog\n\n## 1.0.0", encoding="utf-8")
+    docs = root / "docs"
+    docs.mkdir(exist_ok=True)
+    for i in range(guides):
+        (docs / f"guide{i}.md").write_text(
+            f"# Guide {i}\n\nHow to use feature {i}.", encoding="utf-8"
+        )
+    config_file = root / "config.yaml"
+    config_file.write_text("modules: {}\n", encoding="utf-8")
+    return config_file
+
+
+def timed(func: Callable[[], Any], repeat: int) -> Dict[str, float]:
+    """Run func repeat times and report best and mean wall time."""
+    samples = []
+    for _ in range(repeat):
+        start = time.perf_counter()
+        func()
+        samples.append(time.perf_counter() - start)
+    return {"best": min(samples), "mean": statistics.mean(samples)}
+
+
+def run_benchmarks(args: argparse.Namespace) -> Dict[str, Dict[str, float]]:
+    """Run every benchmark and return name -> timing stats."""
+    results: Dict[str, Dict[str, float]] = {}
+
+    markdown = make_markdown(args.include_kb)
+    results["convert_markdown_to_rst"] = timed(
+        lambda: convert_markdown_to_rst(markdown), args.repeat
+    )
+
+    proto_source = make_proto(args.proto_messages)
+    extractor = ProtoDocExtractor()
+    results["parse_proto_file"] = timed(
+        lambda: extractor.parse_proto_file(proto_source), args.repeat
+    )
+
+    with tempfile.TemporaryDirectory() as tmp:
+        config_file = build_synthetic_config(
+            Path(tmp), args.pages, args.depth, args.include_kb
+        )
+
+        def generate() -> None:
+            generator = IntroligoGenerator(config_file, Path(tmp) / "docs")
+            generator.load_config()
+            generator.build_page_tree()
+            template = generator.load_template()
+            generator.generate_all_nodes(generator.page_tree, template)
+
+        results["generate_all_nodes"] = timed(generate, args.repeat)
+
+    with tempfile.TemporaryDirectory() as tmp:
+        config_file = build_synthetic_repo(Path(tmp), guides=args.pages // 4 or 1)
+        config = {
+            "discovery": {
+                "enabled": True,
+                "cache": False,
+                "auto_include": {
+                    "readme": True,
+                    "changelog": True,
+                    "markdown_docs": "docs/**/*.md",
+                },
+            }
+        }
+        hub = DocumentationHub(config_file, config)
+        results["hub_discovery"] = timed(hub.discover_documentation, args.repeat)
+
+    return results
+
+
+def check_regressions(
+    previous: Dict[str, Any], current: Dict[str, Dict[str, float]], threshold: float
+) -> bool:
+    """Compare against the last recorded run.
+
+    Args:
+        previous: Last recorded results entry.
+        current: Freshly measured results.
+        threshold: Allowed slowdown factor before failing.
+
+    Returns:
+        True if a regression beyond the threshold was found.
+    """
+    regressed = False
+    for name, stats in current.items():
+        old = previous.get("results", {}).get(name)
+        if not old:
+            continue
+        ratio = stats["best"] / old["best"] if old["best"] > 0 else 1.0
+        marker = ""
+        if ratio > threshold:
+            marker = "  <-- REGRESSION"
+            regressed = True
+        print(
+            f"  {name:<28} {old['best'] * 1000:8.1f} ms -> "
+            f"{stats['best'] * 1000:8.1f} ms ({ratio:.2f}x){marker}"
+        )
+    return regressed
+
+
+def main() -> None:
+    """Run the benchmark suite."""
+    parser = argparse.ArgumentParser(description="Introligo performance benchmarks")
+    parser.add_argument("--pages", type=int, default=200, help="Synthetic page count")
+    parser.add_argument("--depth", type=int, default=5, help="Tree nesting depth")
+    parser.add_argument("--include-kb", type=int, default=16, help="Markdown include size in KB")
+    parser.add_argument("--proto-messages", type=int, default=100, help="Messages per .proto")
+    parser.add_argument("--repeat", type=int, default=3, help="Samples per benchmark")
+    parser.add_argument(
+        "--results", type=Path, default=DEFAULT_RESULTS, help="JSON history file"
+    )
+    parser.add_argument(
+        "--check", action="store_true", help="Exit non-zero if slower than the last run"
+    )
+    parser.add_argument(
+        "--threshold", type=float, default=1.5, help="Allowed slowdown factor for --check"
+    )
+    args = parser.parse_args()
+
+    print(f"Running benchmarks (pages={args.pages}, depth={args.depth}, repeat={args.repeat})")
+    results = run_benchmarks(args)
+    for name, stats in results.items():
+        print(
+            f"  {name:<28} best {stats['best'] * 1000:8.1f} ms"
+            f"  mean {stats['mean'] * 1000:8.1f} ms"
+        )
+
+    history = []
+    if args.results.exists():
+        try:
+            history = json.loads(args.results.read_text(encoding="utf-8"))
+        except json.JSONDecodeError:
+            print(f"Warning: could not parse {args.results}, starting fresh history")
+
+    regressed = False
+    if history:
+        print("\nComparison with previous run:")
+        regressed = check_regressions(history[-1], results, args.threshold)
+
+    history.append(
+        {
+            "timestamp": time.strftime("%Y-%m-%dT%H:%M:%S"),
+            "parameters": {
+                "pages": args.pages,
+                "depth": args.depth,
+                "include_kb": args.include_kb,
+                "proto_messages": args.proto_messages,
+                "repeat": args.repeat,
+            },
+            "results": results,
+        }
+    )
+    args.results.write_text(json.dumps(history, indent=2), encoding="utf-8")
+    print(f"\nResults recorded in {args.results}")
+
+    if args.check and regressed:
+        print("Benchmark regression detected!")
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()